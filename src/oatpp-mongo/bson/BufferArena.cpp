@@ -0,0 +1,78 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BufferArena.hpp"
+
+namespace oatpp { namespace mongo { namespace bson {
+
+BufferArena::Buffer::Buffer(BufferArena* arena, data::stream::BufferOutputStream* stream)
+  : m_arena(arena)
+  , m_stream(stream)
+{}
+
+BufferArena::Buffer::Buffer(Buffer&& other)
+  : m_arena(other.m_arena)
+  , m_stream(other.m_stream)
+{
+  other.m_arena = nullptr;
+  other.m_stream = nullptr;
+}
+
+BufferArena::Buffer::~Buffer() {
+  if(m_arena) {
+    m_arena->release(m_stream);
+  }
+}
+
+BufferArena::~BufferArena() {
+  for(auto stream : m_freeBuffers) {
+    delete stream;
+  }
+}
+
+BufferArena& BufferArena::getThreadLocal() {
+  static thread_local BufferArena arena;
+  return arena;
+}
+
+BufferArena::Buffer BufferArena::borrow() {
+  if(m_freeBuffers.empty()) {
+    return Buffer(this, new data::stream::BufferOutputStream());
+  }
+  auto stream = m_freeBuffers.back();
+  m_freeBuffers.pop_back();
+  return Buffer(this, stream);
+}
+
+void BufferArena::release(data::stream::BufferOutputStream* stream) {
+  if((v_int32) m_freeBuffers.size() < MAX_FREE_BUFFERS && stream->getCapacity() <= MAX_BUFFER_CAPACITY) {
+    stream->setCurrentPosition(0);
+    m_freeBuffers.push_back(stream);
+  } else {
+    delete stream;
+  }
+}
+
+}}}
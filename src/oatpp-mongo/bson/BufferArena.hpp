@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_BufferArena_hpp
+#define oatpp_mongo_bson_BufferArena_hpp
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+/**
+ * Pool of reusable scratch buffers. <br>
+ * Borrowed buffers are returned to the arena when the &l:BufferArena::Buffer; handle goes out of scope,
+ * and keep their capacity between uses. <br>
+ * BufferArena is not thread-safe - use &l:BufferArena::getThreadLocal (); to get the arena of the current thread.
+ */
+class BufferArena {
+public:
+
+  /**
+   * Max count of free buffers kept by the arena.
+   */
+  static constexpr v_int32 MAX_FREE_BUFFERS = 8;
+
+  /**
+   * Buffers grown larger than this are freed instead of being returned to the arena.
+   */
+  static constexpr v_buff_size MAX_BUFFER_CAPACITY = 4 * 1024 * 1024;
+
+public:
+
+  /**
+   * Handle of the borrowed buffer. Returns buffer to the arena on destruction.
+   */
+  class Buffer {
+    friend BufferArena;
+  private:
+    BufferArena* m_arena;
+    data::stream::BufferOutputStream* m_stream;
+  private:
+    Buffer(BufferArena* arena, data::stream::BufferOutputStream* stream);
+  public:
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    Buffer(Buffer&& other);
+
+    ~Buffer();
+
+    /**
+     * Get buffer stream.
+     * @return - &id:oatpp::data::stream::BufferOutputStream;.
+     */
+    data::stream::BufferOutputStream* get() const {
+      return m_stream;
+    }
+
+    data::stream::BufferOutputStream* operator->() const {
+      return m_stream;
+    }
+
+  };
+
+private:
+  std::vector<data::stream::BufferOutputStream*> m_freeBuffers;
+private:
+  void release(data::stream::BufferOutputStream* stream);
+public:
+
+  BufferArena() = default;
+
+  BufferArena(const BufferArena&) = delete;
+  BufferArena& operator=(const BufferArena&) = delete;
+
+  ~BufferArena();
+
+  /**
+   * Get arena of the current thread.
+   * @return - &l:BufferArena;.
+   */
+  static BufferArena& getThreadLocal();
+
+  /**
+   * Borrow empty buffer. The buffer must be released (the handle destroyed) on the same thread.
+   * @return - &l:BufferArena::Buffer;.
+   */
+  Buffer borrow();
+
+};
+
+}}}
+
+#endif // oatpp_mongo_bson_BufferArena_hpp
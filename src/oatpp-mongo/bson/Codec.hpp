@@ -0,0 +1,455 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_Codec_hpp
+#define oatpp_mongo_bson_Codec_hpp
+
+#include "./mapping/Deserializer.hpp"
+#include "./BufferArena.hpp"
+#include "./Utils.hpp"
+#include "./Types.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+/**
+ * Statically typed encoder/decoder of a single BSON value. <br>
+ * Supported types: Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64, Float32, Float64, Boolean, String,
+ * &id:oatpp::mongo::bson::ObjectId;, &id:oatpp::mongo::bson::DateTime;.
+ * @tparam Wrapper - ObjectWrapper type.
+ */
+template<class Wrapper>
+class CodecValue {
+  static_assert(sizeof(Wrapper) == 0, "[oatpp::mongo::bson::CodecValue]: Error. Type is not supported by Codec.");
+};
+
+template<typename T, class Clazz>
+class CodecValue<data::mapping::type::Primitive<T, Clazz>> {
+public:
+  typedef data::mapping::type::Primitive<T, Clazz> Wrapper;
+public:
+
+  static void write(data::stream::ConsistentOutputStream* stream, const data::share::StringKeyLabel& key, const Wrapper& value) {
+    if(value) {
+      Utils::writePrimitive(stream, key, *value);
+    } else {
+      Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+    }
+  }
+
+  static void read(parser::Caret& caret, Wrapper& value, v_char8 bsonTypeCode) {
+    if(bsonTypeCode == TypeCode::NULL_VALUE) {
+      value = Wrapper();
+      return;
+    }
+    T v;
+    Utils::readPrimitive(caret, v, bsonTypeCode);
+    value = v;
+  }
+
+  static Wrapper createProbe() {
+    return Wrapper(T());
+  }
+
+};
+
+template<>
+class CodecValue<oatpp::Boolean> {
+public:
+
+  static void write(data::stream::ConsistentOutputStream* stream, const data::share::StringKeyLabel& key, const oatpp::Boolean& value) {
+    if(value) {
+      Utils::writePrimitive(stream, key, (bool) *value);
+    } else {
+      Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+    }
+  }
+
+  static void read(parser::Caret& caret, oatpp::Boolean& value, v_char8 bsonTypeCode) {
+    switch(bsonTypeCode) {
+      case TypeCode::NULL_VALUE:
+        value = oatpp::Boolean();
+        return;
+      case TypeCode::BOOLEAN:
+        if(caret.canContinueAtChar(0, 1)) {
+          value = false;
+        } else if(caret.canContinueAtChar(1, 1)) {
+          value = true;
+        } else {
+          caret.setError("[oatpp::mongo::bson::CodecValue<Boolean>::read()]: Error. Invalid boolean value.");
+        }
+        return;
+      default:
+        caret.setError("[oatpp::mongo::bson::CodecValue<Boolean>::read()]: Error. Type-code doesn't match boolean.");
+    }
+  }
+
+  static oatpp::Boolean createProbe() {
+    return oatpp::Boolean(false);
+  }
+
+};
+
+template<>
+class CodecValue<oatpp::String> {
+public:
+
+  static void write(data::stream::ConsistentOutputStream* stream, const data::share::StringKeyLabel& key, const oatpp::String& value) {
+    if(value) {
+      Utils::writeKey(stream, TypeCode::STRING, key);
+      Utils::writeInt32(stream, (v_int32) value->size() + 1);
+      stream->writeSimple(value->data(), value->size());
+      stream->writeCharSimple(0);
+    } else {
+      Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+    }
+  }
+
+  static void read(parser::Caret& caret, oatpp::String& value, v_char8 bsonTypeCode) {
+    switch(bsonTypeCode) {
+      case TypeCode::NULL_VALUE:
+        value = oatpp::String();
+        return;
+      case TypeCode::STRING: {
+        v_int32 size = Utils::readInt32(caret);
+        if (size + caret.getPosition() > caret.getDataSize() || size < 1) {
+          caret.setError("[oatpp::mongo::bson::CodecValue<String>::read()]: Error. Invalid string size.");
+          return;
+        }
+        value = oatpp::String(caret.getCurrData(), size - 1);
+        caret.inc(size);
+        return;
+      }
+      default:
+        caret.setError("[oatpp::mongo::bson::CodecValue<String>::read()]: Error. Type-code doesn't match string.");
+    }
+  }
+
+  static oatpp::String createProbe() {
+    return oatpp::String("");
+  }
+
+};
+
+template<>
+class CodecValue<bson::ObjectId> {
+public:
+
+  static void write(data::stream::ConsistentOutputStream* stream, const data::share::StringKeyLabel& key, const bson::ObjectId& value) {
+    if(value) {
+      Utils::writeKey(stream, TypeCode::OBJECT_ID, key);
+      stream->writeSimple(value->getData(), value->getSize());
+    } else {
+      Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+    }
+  }
+
+  static void read(parser::Caret& caret, bson::ObjectId& value, v_char8 bsonTypeCode) {
+    switch(bsonTypeCode) {
+      case TypeCode::NULL_VALUE:
+        value = bson::ObjectId();
+        return;
+      case TypeCode::OBJECT_ID:
+        if(caret.getPosition() + type::ObjectId::DATA_SIZE > caret.getDataSize()) {
+          caret.setError("[oatpp::mongo::bson::CodecValue<ObjectId>::read()]: Error. Invalid parsing state.");
+          return;
+        }
+        value = bson::ObjectId(std::make_shared<type::ObjectId>((p_char8) caret.getCurrData()), bson::ObjectId::Class::getType());
+        caret.inc(type::ObjectId::DATA_SIZE);
+        return;
+      default:
+        caret.setError("[oatpp::mongo::bson::CodecValue<ObjectId>::read()]: Error. Invalid type code.");
+    }
+  }
+
+  static bson::ObjectId createProbe() {
+    return bson::ObjectId(std::make_shared<type::ObjectId>(), bson::ObjectId::Class::getType());
+  }
+
+};
+
+template<>
+class CodecValue<bson::DateTime> {
+public:
+
+  static void write(data::stream::ConsistentOutputStream* stream, const data::share::StringKeyLabel& key, const bson::DateTime& value) {
+    if(value) {
+      Utils::writeKey(stream, TypeCode::DATE_TIME, key);
+      Utils::writeInt64(stream, *value);
+    } else {
+      Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+    }
+  }
+
+  static void read(parser::Caret& caret, bson::DateTime& value, v_char8 bsonTypeCode) {
+    switch(bsonTypeCode) {
+      case TypeCode::NULL_VALUE:
+        value = bson::DateTime();
+        return;
+      case TypeCode::DATE_TIME:
+        value = Utils::readInt64(caret);
+        return;
+      default:
+        caret.setError("[oatpp::mongo::bson::CodecValue<DateTime>::read()]: Error. Type-code doesn't match DateTime.");
+    }
+  }
+
+  static bson::DateTime createProbe() {
+    return bson::DateTime((v_int64) 0);
+  }
+
+};
+
+/**
+ * DTO field bound to &l:CodecValue;. Use &l:OATPP_MONGO_BSON_CODEC_FIELD (); macro to declare.
+ * @tparam DTO - DTO class.
+ * @tparam Wrapper - type of the field.
+ * @tparam MEMBER - pointer to the field.
+ */
+template<class DTO, class Wrapper, Wrapper DTO::*MEMBER>
+class CodecField {
+public:
+
+  static void write(data::stream::ConsistentOutputStream* stream, const data::share::StringKeyLabel& key, DTO* object) {
+    CodecValue<Wrapper>::write(stream, key, object->*MEMBER);
+  }
+
+  static void read(parser::Caret& caret, DTO* object, v_char8 bsonTypeCode) {
+    CodecValue<Wrapper>::read(caret, object->*MEMBER, bsonTypeCode);
+  }
+
+  static const void* probe(DTO* object) {
+    object->*MEMBER = CodecValue<Wrapper>::createProbe();
+    return (object->*MEMBER).get();
+  }
+
+};
+
+/**
+ * Declare &l:CodecField; of the DTO.
+ * @param DTO - DTO class.
+ * @param NAME - name of the field.
+ */
+#define OATPP_MONGO_BSON_CODEC_FIELD(DTO, NAME) \
+oatpp::mongo::bson::CodecField<DTO, decltype(DTO::NAME), &DTO::NAME>
+
+/**
+ * Compile-time BSON codec for flat DTOs. <br>
+ * Fields are encoded/decoded by concrete &l:CodecValue; methods resolved at compile time,
+ * bypassing the `oatpp::Void` type dispatch of &id:oatpp::mongo::bson::mapping::ObjectMapper;. <br>
+ * Produces the same bytes as &id:oatpp::mongo::bson::mapping::ObjectMapper; with the default config. <br>
+ * `Fields` must list all fields of the DTO in the order of declaration - this is checked on first use.
+ * Unknown fields are skipped on decode.
+ * ```cpp
+ * typedef oatpp::mongo::bson::Codec<MyDto,
+ *   OATPP_MONGO_BSON_CODEC_FIELD(MyDto, id),
+ *   OATPP_MONGO_BSON_CODEC_FIELD(MyDto, name)
+ * > MyDtoCodec;
+ *
+ * oatpp::String bson = MyDtoCodec::encodeToString(dto);
+ * ```
+ * @tparam DTO - DTO class.
+ * @tparam Fields - &l:CodecField;s.
+ */
+template<class DTO, class ... Fields>
+class Codec {
+  static_assert(sizeof...(Fields) > 0, "[oatpp::mongo::bson::Codec]: Error. DTO has no fields.");
+private:
+
+  typedef void (*ReadMethod)(parser::Caret&, DTO*, v_char8);
+
+private:
+
+  static std::vector<data::share::StringKeyLabel> resolveKeys() {
+
+    auto object = DTO::createShared();
+    const void* probes[] = {Fields::probe(object.get())...};
+
+    auto dispatcher = static_cast<const data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(
+      oatpp::Object<DTO>::Class::getType()->polymorphicDispatcher
+    );
+
+    const auto& properties = dispatcher->getProperties()->getList();
+    if(properties.size() != sizeof...(Fields)) {
+      throw std::runtime_error("[oatpp::mongo::bson::Codec::resolveKeys()]: Error. Codec fields don't match DTO fields.");
+    }
+
+    std::vector<data::share::StringKeyLabel> keys;
+    keys.reserve(sizeof...(Fields));
+
+    v_int32 index = 0;
+    for(auto* property : properties) {
+      if(property->get(static_cast<oatpp::BaseObject*>(object.get())).get() != probes[index ++]) {
+        throw std::runtime_error("[oatpp::mongo::bson::Codec::resolveKeys()]: Error. "
+                                 "Codec fields must list DTO fields in the order of declaration.");
+      }
+      keys.push_back(data::share::StringKeyLabel(nullptr, property->name, std::strlen(property->name)));
+    }
+
+    return keys;
+
+  }
+
+  static const std::vector<data::share::StringKeyLabel>& getKeys() {
+    static const std::vector<data::share::StringKeyLabel> keys = resolveKeys();
+    return keys;
+  }
+
+public:
+
+  /**
+   * Encode DTO and append it to the stream.
+   * @param stream - &id:oatpp::data::stream::BufferOutputStream;.
+   * @param object - DTO.
+   */
+  static void encode(data::stream::BufferOutputStream* stream, const oatpp::Object<DTO>& object) {
+
+    if(!object) {
+      throw std::runtime_error("[oatpp::mongo::bson::Codec::encode()]: Error. null object.");
+    }
+
+    const auto* key = getKeys().data();
+    DTO* dto = object.get();
+
+    v_buff_size lengthPosition = stream->getCurrentPosition();
+    Utils::writeInt32(stream, 0);
+
+    int expand[] = {0, (Fields::write(stream, *key ++, dto), 0)...};
+    (void) expand;
+
+    stream->writeCharSimple(0);
+    Utils::writeInt32(stream->getData() + lengthPosition, (v_int32) (stream->getCurrentPosition() - lengthPosition));
+
+  }
+
+  /**
+   * Encode DTO to string.
+   * @param object - DTO.
+   * @return - BSON document.
+   */
+  static oatpp::String encodeToString(const oatpp::Object<DTO>& object) {
+    auto stream = BufferArena::getThreadLocal().borrow();
+    encode(stream.get(), object);
+    return stream->toString();
+  }
+
+  /**
+   * Decode DTO. In case of error, caret error is set and `nullptr` is returned.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - DTO.
+   */
+  static oatpp::Object<DTO> decode(parser::Caret& caret) {
+
+    static const ReadMethod readMethods[] = {&Fields::read...};
+    const v_int32 fieldsCount = sizeof...(Fields);
+    const auto& keys = getKeys();
+
+    v_int32 docSize = Utils::readInt32(caret);
+    if (docSize - 4 + caret.getPosition() > caret.getDataSize() || docSize < 5) {
+      caret.setError("[oatpp::mongo::bson::Codec::decode()]: Error. Invalid document size.");
+      return nullptr;
+    }
+
+    parser::Caret innerCaret(caret.getCurrData(), docSize - 4);
+    auto object = DTO::createShared();
+
+    v_int32 expectedIndex = 0;
+
+    while(innerCaret.getPosition() < innerCaret.getDataSize() - 1) {
+
+      v_char8 valueType = *innerCaret.getCurrData();
+      innerCaret.inc();
+
+      const char* keyData = innerCaret.getCurrData();
+      v_buff_size keySize = Utils::findCStringSize(innerCaret);
+      if(keySize < 0) {
+        caret.inc(innerCaret.getDataSize());
+        caret.setError("[oatpp::mongo::bson::Codec::decode()]: Error. Unterminated key.");
+        return nullptr;
+      }
+      innerCaret.inc(keySize + 1);
+
+      // Fields are usually stored in the order of declaration - try the next field first.
+      v_int32 fieldIndex = -1;
+      for(v_int32 i = 0; i < fieldsCount; i ++) {
+        v_int32 index = (expectedIndex + i) % fieldsCount;
+        const auto& key = keys[index];
+        if(key.getSize() == keySize && std::memcmp(key.getData(), keyData, keySize) == 0) {
+          fieldIndex = index;
+          break;
+        }
+      }
+
+      if(fieldIndex >= 0) {
+        readMethods[fieldIndex](innerCaret, object.get(), valueType);
+        expectedIndex = fieldIndex + 1;
+      } else {
+        mapping::Deserializer::skipElement(innerCaret, valueType);
+      }
+
+      if(innerCaret.hasError()) {
+        caret.inc(innerCaret.getPosition());
+        caret.setError(innerCaret.getErrorMessage(), innerCaret.getErrorCode());
+        return nullptr;
+      }
+
+    }
+
+    if(!innerCaret.canContinueAtChar(0, 1)) {
+      caret.inc(innerCaret.getPosition());
+      caret.setError("[oatpp::mongo::bson::Codec::decode()]: Error. '\\0' - expected");
+      return nullptr;
+    }
+
+    caret.inc(innerCaret.getPosition());
+    return object;
+
+  }
+
+  /**
+   * Decode DTO from string.
+   * @param bson - BSON document.
+   * @return - DTO.
+   * @throws - `std::runtime_error` in case of parsing error.
+   */
+  static oatpp::Object<DTO> decodeFromString(const oatpp::String& bson) {
+    parser::Caret caret(bson);
+    auto result = decode(caret);
+    if(caret.hasError()) {
+      throw std::runtime_error(caret.getErrorMessage());
+    }
+    return result;
+  }
+
+};
+
+}}}
+
+#endif // oatpp_mongo_bson_Codec_hpp
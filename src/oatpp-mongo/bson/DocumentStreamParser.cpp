@@ -0,0 +1,138 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentStreamParser.hpp"
+
+#include "./Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+DocumentStreamParser::DocumentStreamParser(v_buff_size maxDocumentSize)
+  : m_maxDocumentSize(maxDocumentSize)
+  , m_sizeBytes(0)
+  , m_documentPosition(0)
+{}
+
+void DocumentStreamParser::beginDocument() {
+
+  parser::Caret caret((const char*) m_sizeBuffer, 4);
+  v_int32 size = Utils::readInt32(caret);
+
+  if(size < 5 || size > m_maxDocumentSize) {
+    m_errorMessage = "[oatpp::mongo::bson::DocumentStreamParser::feed()]: Error. Invalid document size.";
+    return;
+  }
+
+  m_document = oatpp::String((v_buff_size) size);
+  std::memcpy((void*) m_document->data(), m_sizeBuffer, 4);
+  m_documentPosition = 4;
+
+}
+
+v_buff_size DocumentStreamParser::feed(const void* data, v_buff_size size) {
+
+  const char* bytes = (const char*) data;
+  v_buff_size position = 0;
+
+  while(position < size && !m_errorMessage) {
+
+    if(!m_document) {
+
+      v_buff_size count = std::min<v_buff_size>(4 - m_sizeBytes, size - position);
+      std::memcpy(m_sizeBuffer + m_sizeBytes, bytes + position, count);
+      m_sizeBytes += count;
+      position += count;
+
+      if(m_sizeBytes == 4) {
+        m_sizeBytes = 0;
+        beginDocument();
+      }
+
+      continue;
+
+    }
+
+    v_buff_size documentSize = m_document->size();
+    v_buff_size count = std::min<v_buff_size>(documentSize - m_documentPosition, size - position);
+    std::memcpy((char*) m_document->data() + m_documentPosition, bytes + position, count);
+    m_documentPosition += count;
+    position += count;
+
+    if(m_documentPosition == documentSize) {
+
+      if(m_document->data()[documentSize - 1] != 0) {
+        m_errorMessage = "[oatpp::mongo::bson::DocumentStreamParser::feed()]: Error. Document is not terminated.";
+        break;
+      }
+
+      m_documents.push_back(m_document);
+      m_document = nullptr;
+      m_documentPosition = 0;
+
+    }
+
+  }
+
+  return position;
+
+}
+
+oatpp::String DocumentStreamParser::nextDocument() {
+  if(m_documents.empty()) {
+    return nullptr;
+  }
+  auto document = m_documents.front();
+  m_documents.pop_front();
+  return document;
+}
+
+v_buff_size DocumentStreamParser::getDocumentsCount() const {
+  return (v_buff_size) m_documents.size();
+}
+
+bool DocumentStreamParser::isAtBoundary() const {
+  return !m_document && m_sizeBytes == 0;
+}
+
+bool DocumentStreamParser::hasError() const {
+  return m_errorMessage != nullptr;
+}
+
+oatpp::String DocumentStreamParser::getErrorMessage() const {
+  return m_errorMessage;
+}
+
+void DocumentStreamParser::reset() {
+  m_sizeBytes = 0;
+  m_document = nullptr;
+  m_documentPosition = 0;
+  m_documents.clear();
+  m_errorMessage = nullptr;
+}
+
+}}}
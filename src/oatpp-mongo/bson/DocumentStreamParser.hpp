@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_DocumentStreamParser_hpp
+#define oatpp_mongo_bson_DocumentStreamParser_hpp
+
+#include "./mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/Types.hpp"
+
+#include <list>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+/**
+ * Incremental parser of the stream of BSON documents. <br>
+ * Bytes are pushed in chunks of any size with &l:DocumentStreamParser::feed ();. Documents become available
+ * with &l:DocumentStreamParser::nextDocument (); as soon as their last byte is received, so decoding can proceed
+ * while the rest of the stream is still being received. <br>
+ * Each document is copied once - to its own buffer, which is then referenced by the values decoded from it
+ * (see &id:oatpp::mongo::bson::mapping::Deserializer::SourceBufferScope;). <br>
+ * Only document sizes and terminators are checked here - document contents are checked when deserialized. <br>
+ * Not thread-safe.
+ */
+class DocumentStreamParser {
+public:
+
+  /**
+   * Default max size of the document. Max BSON object size of MongoDB plus the room for the command overhead.
+   */
+  static constexpr v_buff_size DEFAULT_MAX_DOCUMENT_SIZE = 16 * 1024 * 1024 + 16 * 1024;
+
+private:
+  v_buff_size m_maxDocumentSize;
+  v_char8 m_sizeBuffer[4];
+  v_buff_size m_sizeBytes;
+  oatpp::String m_document;
+  v_buff_size m_documentPosition;
+  std::list<oatpp::String> m_documents;
+  oatpp::String m_errorMessage;
+private:
+  void beginDocument();
+public:
+
+  /**
+   * Constructor.
+   * @param maxDocumentSize - max size of the document. Larger documents are treated as a stream error.
+   */
+  DocumentStreamParser(v_buff_size maxDocumentSize = DEFAULT_MAX_DOCUMENT_SIZE);
+
+  /**
+   * Push the next chunk of the stream.
+   * @param data - pointer to data.
+   * @param size - size of data.
+   * @return - number of bytes consumed. Less than `size` only if the stream is invalid - see &l:DocumentStreamParser::hasError ();.
+   */
+  v_buff_size feed(const void* data, v_buff_size size);
+
+  /**
+   * Get the next completed document.
+   * @return - BSON document or `nullptr` if no completed documents are available.
+   */
+  oatpp::String nextDocument();
+
+  /**
+   * Deserialize the next completed document.
+   * @tparam Wrapper - ObjectWrapper type.
+   * @param objectMapper - &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   * @return - deserialized object or `nullptr` if no completed documents are available.
+   */
+  template<class Wrapper>
+  Wrapper nextObject(const mapping::ObjectMapper& objectMapper) {
+    auto document = nextDocument();
+    if(!document) {
+      return nullptr;
+    }
+    return objectMapper.readFromString<Wrapper>(document);
+  }
+
+  /**
+   * Get number of completed documents not yet taken with &l:DocumentStreamParser::nextDocument ();.
+   * @return
+   */
+  v_buff_size getDocumentsCount() const;
+
+  /**
+   * Check if the parser is at the document boundary - there is no partially received document.
+   * @return
+   */
+  bool isAtBoundary() const;
+
+  /**
+   * Check if the stream is invalid. Once an error occurred the parser doesn't consume data until &l:DocumentStreamParser::reset ();.
+   * @return
+   */
+  bool hasError() const;
+
+  /**
+   * Get error message.
+   * @return - error message or `nullptr`.
+   */
+  oatpp::String getErrorMessage() const;
+
+  /**
+   * Drop all the state - partially received and completed documents, and the error.
+   */
+  void reset();
+
+};
+
+}}}
+
+#endif // oatpp_mongo_bson_DocumentStreamParser_hpp
@@ -0,0 +1,90 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "MonotonicArena.hpp"
+
+#include <cstdint>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+namespace {
+
+  std::uintptr_t alignAddress(const char* pointer, v_buff_size alignment) {
+    return ((std::uintptr_t) pointer + alignment - 1) & ~((std::uintptr_t) alignment - 1);
+  }
+
+}
+
+MonotonicArena::MonotonicArena(v_buff_size chunkSize)
+  : m_chunkSize(chunkSize)
+  , m_position(nullptr)
+  , m_end(nullptr)
+  , m_allocatedSize(0)
+{}
+
+MonotonicArena::~MonotonicArena() {
+  for(auto chunk : m_chunks) {
+    delete [] chunk;
+  }
+}
+
+std::shared_ptr<MonotonicArena> MonotonicArena::createShared(v_buff_size chunkSize) {
+  return std::make_shared<MonotonicArena>(chunkSize);
+}
+
+void* MonotonicArena::allocate(v_buff_size size, v_buff_size alignment) {
+
+  m_allocatedSize += size;
+
+  if(m_position != nullptr) {
+    std::uintptr_t position = alignAddress(m_position, alignment);
+    if(position + size <= (std::uintptr_t) m_end) {
+      m_position = (char*) (position + size);
+      return (void*) position;
+    }
+  }
+
+  if(size + alignment > m_chunkSize) {
+    // dedicated chunk - the current chunk stays in use
+    char* chunk = new char[size + alignment];
+    m_chunks.push_back(chunk);
+    return (void*) alignAddress(chunk, alignment);
+  }
+
+  char* chunk = new char[m_chunkSize];
+  m_chunks.push_back(chunk);
+  m_end = chunk + m_chunkSize;
+
+  std::uintptr_t position = alignAddress(chunk, alignment);
+  m_position = (char*) (position + size);
+  return (void*) position;
+
+}
+
+v_buff_size MonotonicArena::getAllocatedSize() const {
+  return m_allocatedSize;
+}
+
+}}}
@@ -0,0 +1,142 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_MonotonicArena_hpp
+#define oatpp_mongo_bson_MonotonicArena_hpp
+
+#include "oatpp/core/Types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+/**
+ * Monotonic memory arena. <br>
+ * Memory is taken from large chunks by bumping a pointer and is never freed individually -
+ * all chunks are freed at once when the arena is destroyed. <br>
+ * Values allocated with &l:MonotonicArena::Allocator; keep the arena alive, so the arena is destroyed
+ * together with the last value allocated from it. <br>
+ * Allocation is not thread-safe. Values may be released on any thread.
+ */
+class MonotonicArena {
+public:
+
+  /**
+   * Default size of the memory chunk.
+   */
+  static constexpr v_buff_size DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+public:
+
+  /**
+   * Standard allocator allocating from the arena. Use it with `std::allocate_shared`.
+   * @tparam T - value type.
+   */
+  template<class T>
+  class Allocator {
+    template<class U>
+    friend class Allocator;
+  private:
+    std::shared_ptr<MonotonicArena> m_arena;
+  public:
+    typedef T value_type;
+  public:
+
+    Allocator(const std::shared_ptr<MonotonicArena>& arena)
+      : m_arena(arena)
+    {}
+
+    template<class U>
+    Allocator(const Allocator<U>& other)
+      : m_arena(other.m_arena)
+    {}
+
+    T* allocate(std::size_t n) {
+      return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+      (void) p;
+      (void) n;
+    }
+
+    template<class U>
+    bool operator==(const Allocator<U>& other) const {
+      return m_arena == other.m_arena;
+    }
+
+    template<class U>
+    bool operator!=(const Allocator<U>& other) const {
+      return m_arena != other.m_arena;
+    }
+
+  };
+
+private:
+  v_buff_size m_chunkSize;
+  std::vector<char*> m_chunks;
+  char* m_position;
+  char* m_end;
+  v_buff_size m_allocatedSize;
+public:
+
+  /**
+   * Constructor.
+   * @param chunkSize - size of the memory chunk. Larger allocations get a chunk of their own.
+   */
+  MonotonicArena(v_buff_size chunkSize = DEFAULT_CHUNK_SIZE);
+
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  ~MonotonicArena();
+
+  /**
+   * Create shared MonotonicArena.
+   * @param chunkSize - size of the memory chunk.
+   * @return - `std::shared_ptr` to MonotonicArena.
+   */
+  static std::shared_ptr<MonotonicArena> createShared(v_buff_size chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Allocate memory.
+   * @param size - size in bytes.
+   * @param alignment - alignment. Power of two.
+   * @return - pointer to the allocated memory.
+   */
+  void* allocate(v_buff_size size, v_buff_size alignment);
+
+  /**
+   * Get total size of memory allocated from the arena.
+   * @return
+   */
+  v_buff_size getAllocatedSize() const;
+
+};
+
+}}}
+
+#endif // oatpp_mongo_bson_MonotonicArena_hpp
@@ -0,0 +1,215 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "SliceList.hpp"
+
+#include "BufferArena.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+SliceList::SliceList(v_buff_size scratchCapacity)
+  : m_scratch(scratchCapacity)
+  , m_referencedSize(0)
+  , m_frozen(false)
+{}
+
+void SliceList::checkNotFrozen() const {
+  if(m_frozen) {
+    throw std::runtime_error("[oatpp::mongo::bson::SliceList::checkNotFrozen()]: Error. "
+                             "SliceList is spliced to another SliceList and can't be modified.");
+  }
+}
+
+data::stream::BufferOutputStream* SliceList::getScratchStream() {
+  checkNotFrozen();
+  return &m_scratch;
+}
+
+void SliceList::addReference(const std::shared_ptr<void>& handle, const void* data, v_buff_size size) {
+  checkNotFrozen();
+  if(size > 0) {
+    m_references.push_back({m_scratch.getCurrentPosition(), handle, data, size, nullptr});
+    m_referencedSize += size;
+  }
+}
+
+void SliceList::addReference(const oatpp::String& str) {
+  if(str) {
+    addReference(str.getPtr(), str->data(), str->size());
+  }
+}
+
+void SliceList::append(const oatpp::String& str, v_buff_size referenceThreshold) {
+  checkNotFrozen();
+  if(str) {
+    if((v_buff_size) str->size() >= referenceThreshold) {
+      addReference(str);
+    } else {
+      m_scratch.writeSimple(str->data(), str->size());
+    }
+  }
+}
+
+void SliceList::append(SliceList& other) {
+
+  checkNotFrozen();
+
+  v_buff_size scratchPosition = 0;
+
+  for(auto& ref : other.m_references) {
+    m_scratch.writeSimple(other.m_scratch.getData() + scratchPosition, ref.position - scratchPosition);
+    m_references.push_back(ref);
+    m_references.back().position = m_scratch.getCurrentPosition();
+    m_referencedSize += ref.size;
+    scratchPosition = ref.position;
+  }
+
+  m_scratch.writeSimple(other.m_scratch.getData() + scratchPosition, other.m_scratch.getCurrentPosition() - scratchPosition);
+
+}
+
+void SliceList::splice(const std::shared_ptr<SliceList>& other) {
+  checkNotFrozen();
+  other->m_frozen = true;
+  v_buff_size size = other->getSize();
+  if(size > 0) {
+    m_references.push_back({m_scratch.getCurrentPosition(), other, nullptr, size, other.get()});
+    m_referencedSize += size;
+  }
+}
+
+void SliceList::rollback(v_buff_size scratchPosition, v_buff_size referencesCount) {
+  checkNotFrozen();
+  while((v_buff_size) m_references.size() > referencesCount) {
+    m_referencedSize -= m_references.back().size;
+    m_references.pop_back();
+  }
+  m_scratch.setCurrentPosition(scratchPosition);
+}
+
+bool SliceList::isFrozen() const {
+  return m_frozen;
+}
+
+v_buff_size SliceList::getReferencesCount() const {
+  return m_references.size();
+}
+
+v_buff_size SliceList::getReferencedSize() const {
+  return m_referencedSize;
+}
+
+v_buff_size SliceList::getSize() {
+  return m_scratch.getCurrentPosition() + m_referencedSize;
+}
+
+void SliceList::collectSlices(std::vector<Slice>& result) {
+
+  p_char8 scratchData = m_scratch.getData();
+  v_buff_size scratchPosition = 0;
+
+  for(auto& ref : m_references) {
+    if(ref.position > scratchPosition) {
+      result.push_back({scratchData + scratchPosition, ref.position - scratchPosition});
+    }
+    if(ref.list) {
+      ref.list->collectSlices(result);
+    } else {
+      result.push_back({ref.data, ref.size});
+    }
+    scratchPosition = ref.position;
+  }
+
+  if(m_scratch.getCurrentPosition() > scratchPosition) {
+    result.push_back({scratchData + scratchPosition, m_scratch.getCurrentPosition() - scratchPosition});
+  }
+
+}
+
+std::vector<SliceList::Slice> SliceList::getSlices() {
+  std::vector<Slice> result;
+  result.reserve(m_references.size() * 2 + 1);
+  collectSlices(result);
+  return result;
+}
+
+v_io_size SliceList::writeToStream(data::stream::OutputStream* stream) {
+
+  v_io_size result = 0;
+  auto gathered = BufferArena::getThreadLocal().borrow();
+
+  auto write = [stream, &result](const void* data, v_buff_size size) {
+    auto res = stream->writeExactSizeDataSimple(data, size);
+    if(res < size) {
+      result = res < 0 ? res : result + res;
+      return false;
+    }
+    result += res;
+    return true;
+  };
+
+  for(auto& slice : getSlices()) {
+
+    if(slice.size < GATHER_THRESHOLD) {
+      gathered->writeSimple(slice.data, slice.size);
+      if(gathered->getCurrentPosition() < GATHER_CAPACITY) {
+        continue;
+      }
+    }
+
+    if(gathered->getCurrentPosition() > 0) {
+      if(!write(gathered->getData(), gathered->getCurrentPosition())) {
+        return result;
+      }
+      gathered->setCurrentPosition(0);
+    }
+
+    if(slice.size >= GATHER_THRESHOLD && !write(slice.data, slice.size)) {
+      return result;
+    }
+
+  }
+
+  if(gathered->getCurrentPosition() > 0) {
+    write(gathered->getData(), gathered->getCurrentPosition());
+  }
+
+  return result;
+
+}
+
+oatpp::String SliceList::toString() {
+  oatpp::String result(getSize());
+  p_char8 data = (p_char8) result->data();
+  for(auto& slice : getSlices()) {
+    std::memcpy(data, slice.data, slice.size);
+    data += slice.size;
+  }
+  return result;
+}
+
+}}}
@@ -0,0 +1,198 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_SliceList_hpp
+#define oatpp_mongo_bson_SliceList_hpp
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+/**
+ * Encoded data represented as a list of slices. <br>
+ * Small pieces of data are copied to the scratch buffer, while large values are referenced in place
+ * and are kept alive by their memory handles. This way large values are never copied until they are written to the
+ * destination stream. <br>
+ * Referenced values must not be modified while the SliceList is in use.
+ */
+class SliceList {
+public:
+
+  /**
+   * Default min size of data to be referenced rather than copied to the scratch buffer.
+   * Smaller pieces are not worth a separate write.
+   */
+  static constexpr v_buff_size DEFAULT_REFERENCE_THRESHOLD = 16 * 1024;
+
+public:
+
+  /**
+   * Contiguous piece of encoded data.
+   */
+  struct Slice {
+    const void* data;
+    v_buff_size size;
+  };
+
+private:
+
+  struct Reference {
+    v_buff_size position; // position in the scratch buffer the reference is inserted at.
+    std::shared_ptr<void> handle;
+    const void* data;
+    v_buff_size size;
+    SliceList* list; // spliced SliceList - its slices are inserted in place of `data`.
+  };
+
+private:
+
+  /*
+   * Slices smaller than this are gathered into a single write by `writeToStream()`.
+   */
+  static constexpr v_buff_size GATHER_THRESHOLD = 4 * 1024;
+
+  /*
+   * Gathered data is written once it reaches this size.
+   */
+  static constexpr v_buff_size GATHER_CAPACITY = 64 * 1024;
+
+private:
+  void collectSlices(std::vector<Slice>& result);
+  void checkNotFrozen() const;
+
+private:
+  data::stream::BufferOutputStream m_scratch;
+  std::vector<Reference> m_references;
+  v_buff_size m_referencedSize;
+  bool m_frozen;
+public:
+
+  /**
+   * Constructor.
+   * @param scratchCapacity - initial capacity of the scratch buffer.
+   */
+  SliceList(v_buff_size scratchCapacity = 2048);
+
+  /**
+   * Get scratch stream. Data written to the scratch stream is appended to the end of the SliceList.
+   * @return - &id:oatpp::data::stream::BufferOutputStream;.
+   * @throws - `std::runtime_error` if the SliceList is frozen - see &l:SliceList::splice ();.
+   */
+  data::stream::BufferOutputStream* getScratchStream();
+
+  /**
+   * Append data by reference.
+   * @param handle - memory handle keeping the data alive.
+   * @param data - pointer to data.
+   * @param size - size of data.
+   */
+  void addReference(const std::shared_ptr<void>& handle, const void* data, v_buff_size size);
+
+  /**
+   * Append string by reference.
+   * @param str - &id:oatpp::String;.
+   */
+  void addReference(const oatpp::String& str);
+
+  /**
+   * Append string. The string is referenced if its size is at least `referenceThreshold`, and copied otherwise.
+   * @param str - &id:oatpp::String;.
+   * @param referenceThreshold - min size of the string to be referenced.
+   */
+  void append(const oatpp::String& str, v_buff_size referenceThreshold = DEFAULT_REFERENCE_THRESHOLD);
+
+  /**
+   * Append content of other SliceList. Scratch data is copied, references are shared.
+   * @param other - SliceList to append.
+   */
+  void append(SliceList& other);
+
+  /**
+   * Append other SliceList by reference - nothing is copied. <br>
+   * The other SliceList is frozen - its size is accounted by this SliceList, so any further attempt
+   * to modify it throws `std::runtime_error`. A frozen SliceList may be spliced any number of times.
+   * @param other - SliceList to append.
+   */
+  void splice(const std::shared_ptr<SliceList>& other);
+
+  /**
+   * Drop everything appended after the given state.
+   * @param scratchPosition - position of the scratch stream.
+   * @param referencesCount - count of references.
+   */
+  void rollback(v_buff_size scratchPosition, v_buff_size referencesCount);
+
+  /**
+   * Check if the SliceList is frozen. See &l:SliceList::splice ();.
+   * @return
+   */
+  bool isFrozen() const;
+
+  /**
+   * Get count of references.
+   * @return
+   */
+  v_buff_size getReferencesCount() const;
+
+  /**
+   * Get overall size of referenced data.
+   * @return
+   */
+  v_buff_size getReferencedSize() const;
+
+  /**
+   * Get overall size of data.
+   * @return
+   */
+  v_buff_size getSize();
+
+  /**
+   * Get list of slices in order.
+   * @return
+   */
+  std::vector<Slice> getSlices();
+
+  /**
+   * Write all slices to the stream. Consecutive small slices are gathered into a single write,
+   * large slices are written directly from their memory.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - overall bytes written or error code of the first failed write.
+   */
+  v_io_size writeToStream(data::stream::OutputStream* stream);
+
+  /**
+   * Copy all data to a single string.
+   * @return - &id:oatpp::String;.
+   */
+  oatpp::String toString();
+
+};
+
+}}}
+
+#endif // oatpp_mongo_bson_SliceList_hpp
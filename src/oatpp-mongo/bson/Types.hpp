@@ -26,7 +26,10 @@
 #ifndef oatpp_mongo_bson_Types_hpp
 #define oatpp_mongo_bson_Types_hpp
 
+#include "type/Binary.hpp"
+#include "type/Decimal128.hpp"
 #include "type/ObjectId.hpp"
+#include "type/SharedString.hpp"
 #include "oatpp/core/Types.hpp"
 
 namespace oatpp { namespace mongo { namespace bson {
@@ -198,6 +201,39 @@ namespace __class {
 
   };
 
+  class Binary {
+  public:
+    static const ClassId CLASS_ID;
+
+    static Type *getType() {
+      static Type type(CLASS_ID);
+      return &type;
+    }
+
+  };
+
+  class Decimal128 {
+  public:
+    static const ClassId CLASS_ID;
+
+    static Type *getType() {
+      static Type type(CLASS_ID);
+      return &type;
+    }
+
+  };
+
+  class SharedString {
+  public:
+    static const ClassId CLASS_ID;
+
+    static Type *getType() {
+      static Type type(CLASS_ID);
+      return &type;
+    }
+
+  };
+
 }
 
 /**
@@ -222,6 +258,21 @@ typedef oatpp::data::mapping::type::Primitive<type::ObjectId, __class::ObjectId>
  */
 typedef oatpp::data::mapping::type::Primitive<v_int64, __class::DateTime> DateTime;
 
+/**
+ * BSON Binary data as oatpp primitive type. See &id:oatpp::mongo::bson::type::Binary;.
+ */
+typedef oatpp::data::mapping::type::Primitive<type::Binary, __class::Binary> Binary;
+
+/**
+ * BSON Decimal128 as oatpp primitive type. See &id:oatpp::mongo::bson::type::Decimal128;.
+ */
+typedef oatpp::data::mapping::type::Primitive<type::Decimal128, __class::Decimal128> Decimal128;
+
+/**
+ * String referencing the source BSON document as oatpp primitive type. See &id:oatpp::mongo::bson::type::SharedString;.
+ */
+typedef oatpp::data::mapping::type::Primitive<type::SharedString, __class::SharedString> SharedString;
+
 }}}
 
 #endif // oatpp_mongo_bson_Types_hpp
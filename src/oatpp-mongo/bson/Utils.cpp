@@ -26,6 +26,7 @@
 #include "Utils.hpp"
 
 #include <iostream>
+#include <cstring>
 
 namespace oatpp { namespace mongo { namespace bson {
 
@@ -56,12 +57,66 @@ Utils::BO_TYPE Utils::detectFloatBO() {
   return result;
 }
 
+const char* Utils::getArrayIndexKeysTable() {
+  static const std::string table = [] {
+    std::string result;
+    for(v_int32 i = 0; i < ARRAY_INDEX_KEYS_COUNT; i ++) {
+      result += std::to_string(i);
+      result.push_back(0);
+    }
+    return result;
+  }();
+  return table.data();
+}
+
+Utils::StringKeyLabel Utils::getArrayIndexKey(v_int32 index, v_char8 (&buffer)[ARRAY_INDEX_KEY_BUFFER_SIZE]) {
+
+  if(index < ARRAY_INDEX_KEYS_COUNT) {
+
+    // Keys are stored as "0\0" "1\0" ... "65535\0" - the offset of the key is computed from its number of digits.
+    v_buff_size offset = 0;
+    v_int32 rangeStart = 0;
+    v_int32 rangeEnd = 10;
+    v_buff_size digits = 1;
+
+    while(index >= rangeEnd) {
+      offset += (v_buff_size) (rangeEnd - rangeStart) * (digits + 1);
+      rangeStart = rangeEnd;
+      rangeEnd *= 10;
+      digits ++;
+    }
+
+    offset += (v_buff_size) (index - rangeStart) * (digits + 1);
+    return StringKeyLabel(nullptr, getArrayIndexKeysTable() + offset, digits);
+
+  }
+
+  v_buff_size pos = ARRAY_INDEX_KEY_BUFFER_SIZE;
+  v_uint32 value = (v_uint32) index;
+  do {
+    buffer[-- pos] = (v_char8) ('0' + value % 10);
+    value /= 10;
+  } while(value > 0);
+
+  return StringKeyLabel(nullptr, (const char*) &buffer[pos], ARRAY_INDEX_KEY_BUFFER_SIZE - pos);
+
+}
+
+v_buff_size Utils::findCStringSize(parser::Caret& caret) {
+  const char* data = caret.getCurrData();
+  const void* end = std::memchr(data, 0, caret.getDataSize() - caret.getPosition());
+  if(end != nullptr) {
+    return (const char*) end - data;
+  }
+  return -1;
+}
+
 oatpp::String Utils::readCString(parser::Caret& caret) {
-  auto label = caret.putLabel();
-  if(caret.findChar(0)) {
-    label.end();
-    caret.inc();
-    return label.toString();
+  v_buff_size size = findCStringSize(caret);
+  if(size >= 0) {
+    oatpp::String result(caret.getCurrData(), size);
+    caret.inc(size + 1);
+    return result;
   }
   caret.setError("[oatpp::mongo::bson::Utils::readCString()]: Error. Unterminated cstring.");
   return nullptr;
@@ -78,17 +133,31 @@ void Utils::writeKey(ConsistentOutputStream *stream, TypeCode typeCode, const St
 oatpp::String Utils::readKey(parser::Caret& caret, v_char8& typeCode) {
   typeCode = *caret.getCurrData();
   caret.inc();
-  auto label = caret.putLabel();
-  if(caret.findChar(0)) {
-    label.end();
-    caret.inc();
-    return label.toString();
+  v_buff_size size = findCStringSize(caret);
+  if(size >= 0) {
+    oatpp::String result(caret.getCurrData(), size);
+    caret.inc(size + 1);
+    return result;
   }
 
   caret.setError("[oatpp::mongo::bson::Utils::readKey()]: Error. Unterminated cstring.");
   return nullptr;
 }
 
+const char* Utils::readKeyInPlace(parser::Caret& caret, v_char8& typeCode, v_buff_size& keySize) {
+  typeCode = *caret.getCurrData();
+  caret.inc();
+  const char* key = caret.getCurrData();
+  keySize = findCStringSize(caret);
+  if(keySize >= 0) {
+    caret.inc(keySize + 1);
+    return key;
+  }
+  caret.setError("[oatpp::mongo::bson::Utils::readKeyInPlace()]: Error. Unterminated cstring.");
+  keySize = 0;
+  return nullptr;
+}
+
 void Utils::writeInt32(ConsistentOutputStream *stream, v_int32 value, BO_TYPE valueBO) {
 
   switch(valueBO) {
@@ -110,6 +179,25 @@ void Utils::writeInt32(ConsistentOutputStream *stream, v_int32 value, BO_TYPE va
 
 }
 
+void Utils::writeInt32(p_char8 buffer, v_int32 value, BO_TYPE valueBO) {
+
+  switch(valueBO) {
+
+    case BO_TYPE::LITTLE:
+      std::memcpy(buffer, &value, 4);
+      break;
+
+    default: {
+      buffer[0] = (v_uint8) (0xFF & value);
+      buffer[1] = (v_uint8) (0xFF & (value >> 8));
+      buffer[2] = (v_uint8) (0xFF & (value >> 16));
+      buffer[3] = (v_uint8) (0xFF & (value >> 24));
+    }
+
+  }
+
+}
+
 v_int32 Utils::readInt32(parser::Caret& caret, BO_TYPE valueBO) {
 
   if(caret.getDataSize() - caret.getPosition() < 4) {
@@ -69,6 +69,20 @@ public:
   static BO_TYPE detectIntBO();
   static BO_TYPE detectFloatBO();
 
+public:
+
+  /**
+   * Number of array index keys ("0", "1", "2", ...) precomputed by &l:Utils::getArrayIndexKey ();.
+   */
+  static constexpr v_int32 ARRAY_INDEX_KEYS_COUNT = 65536;
+
+  /**
+   * Size of the buffer to hold the array index key which is out of the precomputed range.
+   */
+  static constexpr v_buff_size ARRAY_INDEX_KEY_BUFFER_SIZE = 16;
+
+private:
+  static const char* getArrayIndexKeysTable();
 public:
 
   static BO_TYPE INT_BO;
@@ -79,9 +93,37 @@ public:
   static oatpp::String readCString(parser::Caret& caret);
 
   static void writeKey(ConsistentOutputStream *stream, TypeCode typeCode, const StringKeyLabel &key);
+
+  /**
+   * Get key of the array element without memory allocation. <br>
+   * Keys of the first &l:Utils::ARRAY_INDEX_KEYS_COUNT; indices are taken from the shared precomputed table,
+   * keys of larger indices are printed to the `buffer` provided by the caller.
+   * @param index - index of the array element. Must be non-negative.
+   * @param buffer - buffer for indices out of the precomputed range.
+   * @return - &id:oatpp::data::share::StringKeyLabel;. Valid as long as the `buffer` is valid.
+   */
+  static StringKeyLabel getArrayIndexKey(v_int32 index, v_char8 (&buffer)[ARRAY_INDEX_KEY_BUFFER_SIZE]);
   static oatpp::String readKey(parser::Caret& caret, v_char8& typeCode);
 
+  /**
+   * Find size of the cstring at the current caret position. Doesn't move the caret. <br>
+   * Scans with `std::memchr` which common C runtimes implement with SIMD instructions selected by CPU features at runtime.
+   * @param caret - &id:oatpp::parser::Caret; positioned at the cstring.
+   * @return - size of the cstring without the terminating `'\0'`, or `-1` if the cstring is not terminated.
+   */
+  static v_buff_size findCStringSize(parser::Caret& caret);
+
+  /**
+   * Read element type-code and key without memory allocation.
+   * @param caret - &id:oatpp::parser::Caret; positioned at the element.
+   * @param typeCode - out: type-code of the element.
+   * @param keySize - out: size of the key.
+   * @return - pointer to the key in the caret data, or `nullptr` if key is not terminated (caret error is set).
+   */
+  static const char* readKeyInPlace(parser::Caret& caret, v_char8& typeCode, v_buff_size& keySize);
+
   static void writeInt32(ConsistentOutputStream *stream, v_int32 value, BO_TYPE valueBO = INT_BO);
+  static void writeInt32(p_char8 buffer, v_int32 value, BO_TYPE valueBO = INT_BO);
   static v_int32 readInt32(parser::Caret& caret, BO_TYPE valueBO = INT_BO);
 
   static void writeInt64(ConsistentOutputStream *stream, v_int64 value, BO_TYPE valueBO = INT_BO);
@@ -0,0 +1,147 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+WorkerPool::WorkerPool(v_int32 threadsCount)
+  : m_stopped(false)
+{
+  for(v_int32 i = 0; i < threadsCount; i ++) {
+    m_threads.push_back(std::thread(&WorkerPool::runWorker, this));
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopped = true;
+  }
+  m_condition.notify_all();
+  for(auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+WorkerPool& WorkerPool::getDefault() {
+  static WorkerPool pool(std::max<v_int32>((v_int32) std::thread::hardware_concurrency() - 1, 1));
+  return pool;
+}
+
+v_int32 WorkerPool::getThreadsCount() const {
+  return (v_int32) m_threads.size();
+}
+
+bool WorkerPool::runNextTask(Job& job) {
+  v_int32 index = job.nextTask.fetch_add(1);
+  if(index >= job.tasksCount) {
+    return false;
+  }
+  runTask(job, index);
+  return true;
+}
+
+void WorkerPool::runTask(Job& job, v_int32 index) {
+
+  try {
+    job.task(index);
+  } catch (...) {
+    job.errors[index] = std::current_exception();
+  }
+
+  std::lock_guard<std::mutex> lock(job.doneMutex);
+  if(++ job.doneCount == job.tasksCount) {
+    job.doneCondition.notify_all();
+  }
+
+}
+
+void WorkerPool::runWorker() {
+
+  while(true) {
+
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_stopped || !m_jobs.empty(); });
+      if(m_stopped) {
+        return;
+      }
+      job = m_jobs.front();
+    }
+
+    if(!runNextTask(*job)) {
+      /* All tasks of the job are taken - stop offering it to workers */
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(!m_jobs.empty() && m_jobs.front() == job) {
+        m_jobs.pop_front();
+      }
+    }
+
+  }
+
+}
+
+void WorkerPool::run(v_int32 tasksCount, const std::function<void(v_int32)>& task) {
+
+  if(tasksCount <= 0) {
+    return;
+  }
+
+  auto job = std::make_shared<Job>(tasksCount, task);
+
+  if(tasksCount > 1 && !m_threads.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_jobs.push_back(job);
+    }
+    m_condition.notify_all();
+  }
+
+  runTask(*job, 0);
+  while(runNextTask(*job)) {}
+
+  {
+    std::unique_lock<std::mutex> lock(job->doneMutex);
+    job->doneCondition.wait(lock, [&job] { return job->doneCount == job->tasksCount; });
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.remove(job);
+  }
+
+  for(auto& error : job->errors) {
+    if(error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+}
+
+}}}
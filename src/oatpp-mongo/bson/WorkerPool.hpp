@@ -0,0 +1,127 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_WorkerPool_hpp
+#define oatpp_mongo_bson_WorkerPool_hpp
+
+#include "oatpp/core/Types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson {
+
+/**
+ * Fixed pool of worker threads running indexed tasks. <br>
+ * The calling thread of &l:WorkerPool::run (); runs tasks of its own job too, and workers only help it.
+ * This way a task may call `run()` again (ex.: a large collection nested in a document of a parallel batch) -
+ * the count of threads stays bounded and nested jobs never wait for a free worker. <br>
+ * Thread-safe.
+ */
+class WorkerPool {
+private:
+
+  struct Job {
+
+    Job(v_int32 pTasksCount, const std::function<void(v_int32)>& pTask)
+      : task(pTask)
+      , tasksCount(pTasksCount)
+      , nextTask(1) // task 0 is run by the calling thread
+      , doneCount(0)
+      , errors(pTasksCount)
+    {}
+
+    const std::function<void(v_int32)>& task;
+    const v_int32 tasksCount;
+    std::atomic<v_int32> nextTask;
+
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+    v_int32 doneCount;
+
+    std::vector<std::exception_ptr> errors;
+
+  };
+
+private:
+  static void runTask(Job& job, v_int32 index);
+  static bool runNextTask(Job& job);
+  void runWorker();
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::list<std::shared_ptr<Job>> m_jobs;
+  std::vector<std::thread> m_threads;
+  bool m_stopped;
+public:
+
+  /**
+   * Constructor.
+   * @param threadsCount - count of worker threads.
+   */
+  WorkerPool(v_int32 threadsCount);
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * Stop and join worker threads.
+   */
+  ~WorkerPool();
+
+  /**
+   * Get pool shared by the library. Started on first use with `std::thread::hardware_concurrency() - 1` workers -
+   * the calling thread is the remaining one.
+   * @return - &l:WorkerPool;.
+   */
+  static WorkerPool& getDefault();
+
+  /**
+   * Get count of worker threads.
+   * @return
+   */
+  v_int32 getThreadsCount() const;
+
+  /**
+   * Run `task(0)`, `task(1)`, ..., `task(tasksCount - 1)` on the calling thread and on free workers of the pool.
+   * `task(0)` is always run by the calling thread. Returns once all tasks are done.
+   * @param tasksCount - count of tasks.
+   * @param task - task to run. Called concurrently.
+   * @throws - exception of the first failed task (by index) - other tasks are still run to completion.
+   */
+  void run(v_int32 tasksCount, const std::function<void(v_int32)>& task);
+
+};
+
+}}}
+
+#endif // oatpp_mongo_bson_WorkerPool_hpp
@@ -25,6 +25,9 @@
 
 #include "Deserializer.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace oatpp { namespace mongo { namespace bson { namespace mapping {
 
 Deserializer::Deserializer(const std::shared_ptr<Config>& config)
@@ -76,6 +79,12 @@ Deserializer::Deserializer(const std::shared_ptr<Config>& config)
 
   setDeserializerMethod(oatpp::mongo::bson::__class::DateTime::CLASS_ID, &Deserializer::deserializeDateTime);
 
+  setDeserializerMethod(oatpp::mongo::bson::__class::Binary::CLASS_ID, &Deserializer::deserializeBinary);
+
+  setDeserializerMethod(oatpp::mongo::bson::__class::Decimal128::CLASS_ID, &Deserializer::deserializeDecimal128);
+
+  setDeserializerMethod(oatpp::mongo::bson::__class::SharedString::CLASS_ID, &Deserializer::deserializeSharedString);
+
 }
 
 void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& classId, DeserializerMethod method) {
@@ -86,11 +95,244 @@ void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& cla
   m_methods[id] = method;
 }
 
+const Deserializer::FieldPlan* Deserializer::ObjectPlan::findField(const char* key, v_buff_size keySize, v_int32& hint) const {
+
+  if(hint < (v_int32) fields.size()) {
+    const FieldPlan& field = fields[hint];
+    if(field.nameSize == keySize && std::memcmp(field.name, key, keySize) == 0) {
+      hint ++;
+      return &field;
+    }
+  }
+
+  v_int32 low = 0;
+  v_int32 high = (v_int32) sortedFields.size();
+
+  while(low < high) {
+
+    v_int32 middle = (low + high) / 2;
+    const FieldPlan& field = fields[sortedFields[middle]];
+
+    v_int32 cmp;
+    if(field.nameSize != keySize) {
+      cmp = field.nameSize < keySize ? -1 : 1;
+    } else {
+      cmp = std::memcmp(field.name, key, keySize);
+    }
+
+    if(cmp == 0) {
+      hint = sortedFields[middle] + 1;
+      return &field;
+    } else if(cmp < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+
+  }
+
+  return nullptr;
+
+}
+
+const Deserializer::ObjectPlan* Deserializer::getObjectPlan(const Type* type) {
+  return m_objectPlans.get(type, &Deserializer::buildObjectPlan);
+}
+
+std::unique_ptr<Deserializer::ObjectPlan> Deserializer::buildObjectPlan(const Type* type) {
+
+  auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  std::unique_ptr<ObjectPlan> plan(new ObjectPlan());
+
+  v_int32 reuseCount = 0;
+  for(auto const& field : dispatcher->getProperties()->getList()) {
+    FieldPlan fieldPlan;
+    fieldPlan.property = field;
+    fieldPlan.name = field->name;
+    fieldPlan.nameSize = std::strlen(field->name);
+    fieldPlan.polymorphic = field->info.typeSelector && field->type == oatpp::Any::Class::getType();
+    fieldPlan.reuseIndex = -1;
+    if(!fieldPlan.polymorphic && reuseCount < 64 &&
+       field->type->classId.id == oatpp::data::mapping::type::__class::AbstractObject::CLASS_ID.id)
+    {
+      fieldPlan.reuseIndex = reuseCount ++;
+    }
+    plan->sortedFields.push_back((v_int32) plan->fields.size());
+    plan->fields.push_back(fieldPlan);
+  }
+
+  const auto& fields = plan->fields;
+  std::sort(plan->sortedFields.begin(), plan->sortedFields.end(), [&fields](v_int32 a, v_int32 b) {
+    const FieldPlan& fa = fields[a];
+    const FieldPlan& fb = fields[b];
+    if(fa.nameSize != fb.nameSize) {
+      return fa.nameSize < fb.nameSize;
+    }
+    return std::memcmp(fa.name, fb.name, fa.nameSize) < 0;
+  });
+
+  return plan;
+
+}
+
+namespace {
+
+  /*
+   * Decimal key of the expected array index - "0", "1", ... Incremented in place.
+   */
+  class ArrayIndexKey {
+  private:
+    static constexpr v_buff_size CAPACITY = 16;
+  private:
+    char m_digits[CAPACITY];
+    v_buff_size m_begin;
+  public:
+
+    ArrayIndexKey()
+      : m_begin(CAPACITY - 1)
+    {
+      m_digits[CAPACITY - 1] = '0';
+    }
+
+    bool equals(const char* key, v_buff_size keySize) const {
+      return keySize == CAPACITY - m_begin && std::memcmp(key, m_digits + m_begin, keySize) == 0;
+    }
+
+    void increment() {
+      v_buff_size i = CAPACITY - 1;
+      while(i >= m_begin && m_digits[i] == '9') {
+        m_digits[i --] = '0';
+      }
+      if(i < m_begin) {
+        m_digits[-- m_begin] = '1';
+      } else {
+        m_digits[i] ++;
+      }
+    }
+
+  };
+
+  thread_local const Deserializer::SourceBufferScope::SourceBuffer* t_sourceBuffer = nullptr;
+
+  /*
+   * Projection node of the document being deserialized. nullptr - no filtering.
+   */
+  thread_local const Projection::Node* t_projection = nullptr;
+
+  thread_local const std::shared_ptr<MonotonicArena>* t_arena = nullptr;
+
+  /*
+   * Existing object to deserialize the next document into. See Deserializer::deserializeInto().
+   */
+  thread_local const oatpp::Void* t_target = nullptr;
+
+  class TargetScope {
+  private:
+    const oatpp::Void* m_prevTarget;
+  public:
+
+    TargetScope(const oatpp::Void* target)
+      : m_prevTarget(t_target)
+    {
+      t_target = target;
+    }
+
+    ~TargetScope() {
+      t_target = m_prevTarget;
+    }
+
+  };
+
+  /*
+   * Take the target object if it is of the requested type. The target is consumed by the first document either way.
+   */
+  oatpp::Void takeTarget(const Type* type) {
+    const oatpp::Void* target = t_target;
+    t_target = nullptr;
+    if(target && *target && target->getValueType() == type) {
+      return *target;
+    }
+    return nullptr;
+  }
+
+  /*
+   * Select projection node for the value of the field.
+   */
+  class FieldProjection {
+  private:
+    const Projection::Node* m_prevNode;
+  public:
+
+    FieldProjection(const Projection::Node* node)
+      : m_prevNode(t_projection)
+    {
+      t_projection = (node && node->isWhole()) ? nullptr : node;
+    }
+
+    ~FieldProjection() {
+      t_projection = m_prevNode;
+    }
+
+  };
+
+}
+
+Deserializer::SourceBufferScope::SourceBufferScope(parser::Caret& caret)
+  : m_prevBuffer(t_sourceBuffer)
+{
+  m_buffer.handle = caret.getDataMemoryHandle();
+  m_buffer.data = caret.getData();
+  m_buffer.size = caret.getDataSize();
+  if(m_buffer.handle) {
+    t_sourceBuffer = &m_buffer;
+  }
+}
+
+Deserializer::SourceBufferScope::~SourceBufferScope() {
+  t_sourceBuffer = m_prevBuffer;
+}
+
+std::shared_ptr<std::string> Deserializer::SourceBufferScope::getHandle(const char* data, v_buff_size size) {
+  auto buffer = t_sourceBuffer;
+  if(buffer && data >= buffer->data && data + size <= buffer->data + buffer->size) {
+    return buffer->handle;
+  }
+  return nullptr;
+}
+
+Deserializer::ProjectionScope::ProjectionScope(const Projection* projection)
+  : m_prevNode(t_projection)
+{
+  t_projection = projection ? projection->getRoot() : nullptr;
+}
+
+Deserializer::ProjectionScope::~ProjectionScope() {
+  t_projection = m_prevNode;
+}
+
+Deserializer::ArenaScope::ArenaScope(const std::shared_ptr<MonotonicArena>& arena)
+  : m_arena(arena)
+  , m_prevArena(t_arena)
+{
+  t_arena = m_arena ? &m_arena : nullptr;
+}
+
+Deserializer::ArenaScope::~ArenaScope() {
+  t_arena = m_prevArena;
+}
+
+const std::shared_ptr<MonotonicArena>* Deserializer::getArena() {
+  return t_arena;
+}
+
 void Deserializer::skipCString(parser::Caret& caret) {
-  caret.findChar(0);
-  if(!caret.canContinueAtChar(0, 1)) {
+  v_buff_size size = Utils::findCStringSize(caret);
+  if(size < 0) {
+    caret.inc(caret.getDataSize() - caret.getPosition());
     caret.setError("[oatpp::mongo::bson::mapping::Deserializer::skipCString()]: Error. Unterminated CString.");
+    return;
   }
+  caret.inc(size + 1);
 }
 
 void Deserializer::skipSizedElement(parser::Caret& caret, v_int32 additionalBytes) {
@@ -144,7 +386,7 @@ const Type* Deserializer::guessType(v_char8 bsonTypeCode) {
     case TypeCode::STRING:              return String::Class::getType();
     case TypeCode::DOCUMENT_EMBEDDED:   return Fields<Any>::Class::getType();
     case TypeCode::DOCUMENT_ARRAY:      return List<Any>::Class::getType();
-    case TypeCode::BINARY:              return nullptr;
+    case TypeCode::BINARY:              return Binary::Class::getType();
     case TypeCode::UNDEFINED:           return nullptr;
     case TypeCode::OBJECT_ID:           return ObjectId::Class::getType();
     case TypeCode::BOOLEAN:             return Boolean::Class::getType();
@@ -158,7 +400,7 @@ const Type* Deserializer::guessType(v_char8 bsonTypeCode) {
     case TypeCode::INT_32:              return Int32::Class::getType();
     case TypeCode::TIMESTAMP:           return UInt64::Class::getType();
     case TypeCode::INT_64:              return Int64::Class::getType();
-    case TypeCode::DECIMAL_128:         return nullptr;
+    case TypeCode::DECIMAL_128:         return Decimal128::Class::getType();
 
     case TypeCode::MIN_KEY:             return nullptr;
     case TypeCode::MAX_KEY:             return nullptr;
@@ -185,9 +427,9 @@ oatpp::Void Deserializer::deserializeBoolean(Deserializer* deserializer,
 
     case TypeCode::BOOLEAN:
       if(caret.canContinueAtChar(0, 1)) {
-        return oatpp::Void(std::make_shared<bool>(false), Boolean::Class::getType());
+        return oatpp::Void(allocateValue<bool>(false), Boolean::Class::getType());
       } else if(caret.canContinueAtChar(1, 1)) {
-        return oatpp::Void(std::make_shared<bool>(true), Boolean::Class::getType());
+        return oatpp::Void(allocateValue<bool>(true), Boolean::Class::getType());
       }
       caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeBoolean()]: Error. Invalid boolean value.");
       return oatpp::Void(Boolean::Class::getType());
@@ -214,7 +456,7 @@ oatpp::Void Deserializer::deserializeDateTime(Deserializer* deserializer,
       return oatpp::Void(DateTime::Class::getType());
 
     case TypeCode::DATE_TIME:
-      return DateTime(Utils::readInt64(caret));
+      return oatpp::Void(allocateValue<v_int64>(Utils::readInt64(caret)), DateTime::Class::getType());
 
     default:
       caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeDateTime()]: Error. Type-code doesn't match DateTime.");
@@ -245,7 +487,7 @@ oatpp::Void Deserializer::deserializeString(Deserializer* deserializer,
       }
       auto label = caret.putLabel();
       caret.inc(size);
-      return oatpp::String(label.getData(), label.getSize() - 1);
+      return oatpp::Void(allocateValue<std::string>(label.getData(), label.getSize() - 1), String::Class::getType());
 
     }
 
@@ -257,6 +499,47 @@ oatpp::Void Deserializer::deserializeString(Deserializer* deserializer,
 
 }
 
+oatpp::Void Deserializer::deserializeSharedString(Deserializer* deserializer,
+                                                  parser::Caret& caret,
+                                                  const Type* const type,
+                                                  v_char8 bsonTypeCode)
+{
+
+  (void) deserializer;
+  (void) type;
+
+  switch(bsonTypeCode) {
+
+    case TypeCode::NULL_VALUE:
+      return oatpp::Void(SharedString::Class::getType());
+
+    case TypeCode::STRING: {
+
+      v_int32 size = Utils::readInt32(caret);
+      if (size + caret.getPosition() > caret.getDataSize() || size < 1) {
+        caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeSharedString()]: Error. Invalid string size.");
+        return nullptr;
+      }
+
+      const char* data = caret.getCurrData();
+      caret.inc(size);
+
+      auto handle = SourceBufferScope::getHandle(data, size - 1);
+      if(handle) {
+        return oatpp::Void(allocateValue<type::SharedString>(handle, data, size - 1), SharedString::Class::getType());
+      }
+      return oatpp::Void(allocateValue<type::SharedString>(oatpp::String(data, size - 1)), SharedString::Class::getType());
+
+    }
+
+    default:
+      caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeSharedString()]: Error. Type-code doesn't match string.");
+      return nullptr;
+
+  }
+
+}
+
 oatpp::Void Deserializer::deserializeInlineDocs(Deserializer* deserializer,
                                                 parser::Caret& caret,
                                                 const Type* const type,
@@ -284,10 +567,10 @@ oatpp::Void Deserializer::deserializeInlineDocs(Deserializer* deserializer,
       label.end();
 
       if(bsonTypeCode == DOCUMENT_ARRAY) {
-        return oatpp::Void(std::make_shared<std::string>(label.getData(), label.getSize()), InlineArray::Class::getType());
+        return oatpp::Void(allocateValue<std::string>(label.getData(), label.getSize()), InlineArray::Class::getType());
       }
 
-      return oatpp::Void(std::make_shared<std::string>(label.getData(), label.getSize()), InlineDocument::Class::getType());
+      return oatpp::Void(allocateValue<std::string>(label.getData(), label.getSize()), InlineDocument::Class::getType());
 
     }
 
@@ -320,7 +603,7 @@ oatpp::Void Deserializer::deserializeObjectId(Deserializer* deserializer,
       auto label = caret.putLabel();
       caret.inc(12);
 
-      return oatpp::Void(std::make_shared<type::ObjectId>((p_char8)label.getData()), ObjectId::Class::getType());
+      return oatpp::Void(allocateValue<type::ObjectId>((p_char8)label.getData()), ObjectId::Class::getType());
 
     }
 
@@ -331,6 +614,85 @@ oatpp::Void Deserializer::deserializeObjectId(Deserializer* deserializer,
 
 }
 
+oatpp::Void Deserializer::deserializeBinary(Deserializer* deserializer,
+                                            parser::Caret& caret,
+                                            const Type* const type,
+                                            v_char8 bsonTypeCode)
+{
+
+  (void) deserializer;
+  (void) type;
+
+  switch(bsonTypeCode) {
+
+    case TypeCode::NULL_VALUE:
+      return oatpp::Void(Binary::Class::getType());
+
+    case TypeCode::BINARY: {
+
+      v_int32 size = Utils::readInt32(caret);
+      if (size < 0 || size + 1 + caret.getPosition() > caret.getDataSize()) {
+        caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeBinary()]: Error. Invalid binary size.");
+        return nullptr;
+      }
+
+      v_uint8 subtype = (v_uint8) *caret.getCurrData();
+      caret.inc();
+
+      const char* data = caret.getCurrData();
+      caret.inc(size);
+
+      auto handle = SourceBufferScope::getHandle(data, size);
+      if(handle) {
+        return oatpp::Void(allocateValue<type::Binary>(handle, data, size, subtype), Binary::Class::getType());
+      }
+      return oatpp::Void(allocateValue<type::Binary>(oatpp::String(data, size), subtype), Binary::Class::getType());
+
+    }
+
+    default:
+      caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeBinary()]: Error. Type-code doesn't match binary.");
+      return nullptr;
+
+  }
+
+}
+
+oatpp::Void Deserializer::deserializeDecimal128(Deserializer* deserializer,
+                                                parser::Caret& caret,
+                                                const Type* const type,
+                                                v_char8 bsonTypeCode)
+{
+
+  (void) deserializer;
+
+  switch(bsonTypeCode) {
+
+    case TypeCode::NULL_VALUE:
+      return oatpp::Void(type);
+
+    case TypeCode::DECIMAL_128:
+    {
+
+      if(caret.getPosition() + type::Decimal128::DATA_SIZE > caret.getDataSize()) {
+        caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeDecimal128()]: Error. Invalid parsing state.");
+        return nullptr;
+      }
+
+      v_uint64 low = Utils::readUInt64(caret);
+      v_uint64 high = Utils::readUInt64(caret);
+
+      return oatpp::Void(allocateValue<type::Decimal128>(high, low), Decimal128::Class::getType());
+
+    }
+
+    default:
+      caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeDecimal128()]: Error. Invalid type code.");
+      return nullptr;
+  }
+
+}
+
 oatpp::Void Deserializer::deserializeAny(Deserializer* deserializer,
                                          parser::Caret& caret,
                                          const Type* const type,
@@ -339,7 +701,10 @@ oatpp::Void Deserializer::deserializeAny(Deserializer* deserializer,
 
   if(bsonTypeCode != TypeCode::NULL_VALUE) {
 
-    const Type *const fieldType = guessType(bsonTypeCode);
+    const Type* fieldType = guessType(bsonTypeCode);
+    if(bsonTypeCode == TypeCode::STRING && deserializer->m_config->zeroCopyStrings) {
+      fieldType = SharedString::Class::getType();
+    }
     if (fieldType != nullptr) {
       auto fieldValue = deserializer->deserialize(caret, fieldType, bsonTypeCode);
       auto anyHandle = std::make_shared<data::mapping::type::AnyHandle>(fieldValue.getPtr(), fieldValue.getValueType());
@@ -413,20 +778,20 @@ oatpp::Void Deserializer::deserializeCollection(Deserializer* deserializer,
       auto collection = dispatcher->createObject();
 
       const Type* itemType = dispatcher->getItemType();
-      v_int32 expectedIndex = 0;
+      const bool validateIndices = deserializer->getConfig()->validateArrayIndices;
+      ArrayIndexKey expectedIndex;
       while(innerCaret.canContinue() && innerCaret.getPosition() < innerCaret.getDataSize() - 1) {
 
         v_char8 valueTypeCode;
-        auto key = Utils::readKey(innerCaret, valueTypeCode);
+        v_buff_size keySize;
+        const char* key = Utils::readKeyInPlace(innerCaret, valueTypeCode, keySize);
         if(innerCaret.hasError()){
           caret.inc(innerCaret.getPosition());
           caret.setError(innerCaret.getErrorMessage(), innerCaret.getErrorCode());
           return nullptr;
         }
 
-        bool success;
-        v_int32 keyIntValue = utils::conversion::strToInt32(key, success);
-        if(!success || keyIntValue != expectedIndex) {
+        if(validateIndices && !expectedIndex.equals(key, keySize)) {
           caret.inc(innerCaret.getPosition());
           caret.setError("[oatpp::mongo::bson::mapping::Deserializer::deserializeCollection()]: Error. Array invalid index value. Looks like it's not an array.");
           return nullptr;
@@ -440,7 +805,7 @@ oatpp::Void Deserializer::deserializeCollection(Deserializer* deserializer,
         }
 
         dispatcher->addItem(collection, item);
-        ++ expectedIndex;
+        expectedIndex.increment();
 
       }
 
@@ -505,17 +870,34 @@ oatpp::Void Deserializer::deserializeMap(Deserializer* deserializer,
       }
 
       const Type* valueType = dispatcher->getValueType();
+      const Projection::Node* projection = t_projection;
       while(innerCaret.canContinue() && innerCaret.getPosition() < innerCaret.getDataSize() - 1) {
 
         v_char8 valueTypeCode;
-        auto key = Utils::readKey(innerCaret, valueTypeCode);
+        v_buff_size keySize;
+        const char* key = Utils::readKeyInPlace(innerCaret, valueTypeCode, keySize);
         if(innerCaret.hasError()){
           caret.inc(innerCaret.getPosition());
           caret.setError(innerCaret.getErrorMessage(), innerCaret.getErrorCode());
           return nullptr;
         }
 
-        dispatcher->addItem(map, key, deserializer->deserialize(innerCaret, valueType, valueTypeCode));
+        if(projection) {
+          const Projection::Node* node = projection->findChild(key, keySize);
+          if(node == nullptr) {
+            skipElement(innerCaret, valueTypeCode);
+            if(innerCaret.hasError()){
+              caret.inc(innerCaret.getPosition());
+              caret.setError(innerCaret.getErrorMessage(), innerCaret.getErrorCode());
+              return nullptr;
+            }
+            continue;
+          }
+          FieldProjection fieldProjection(node);
+          dispatcher->addItem(map, oatpp::String(key, keySize), deserializer->deserialize(innerCaret, valueType, valueTypeCode));
+        } else {
+          dispatcher->addItem(map, oatpp::String(key, keySize), deserializer->deserialize(innerCaret, valueType, valueTypeCode));
+        }
 
       }
 
@@ -571,26 +953,55 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer,
       parser::Caret innerCaret(caret.getCurrData(), docSize - 4);
 
       auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
-      auto object = dispatcher->createObject();
-      const auto& fieldsMap = dispatcher->getProperties()->getMap();
+      auto plan = deserializer->getObjectPlan(type);
+
+      auto object = takeTarget(type);
+      const bool reused = object != nullptr;
+      v_uint64 reusedFields = 0;
+      if(reused) {
+        for(auto& f : plan->fields) {
+          if(f.reuseIndex < 0) {
+            f.property->set(static_cast<oatpp::BaseObject *>(object.get()), oatpp::Void(f.property->type));
+          }
+        }
+      } else {
+        object = dispatcher->createObject();
+      }
+      v_int32 nextField = 0;
+      const Projection::Node* projection = t_projection;
 
       std::vector<PolymorphData> polymorphs;
       while(innerCaret.canContinue() && innerCaret.getPosition() < innerCaret.getDataSize() - 1) {
 
         v_char8 valueType;
-        auto key = Utils::readKey(innerCaret, valueType);
+        v_buff_size keySize;
+        const char* key = Utils::readKeyInPlace(innerCaret, valueType, keySize);
         if(innerCaret.hasError()){
           caret.inc(innerCaret.getPosition());
           caret.setError(innerCaret.getErrorMessage(), innerCaret.getErrorCode());
           return nullptr;
         }
 
-        auto fieldIterator = fieldsMap.find(*key);
-        if(fieldIterator != fieldsMap.end()){
+        const Projection::Node* node = nullptr;
+        if(projection) {
+          node = projection->findChild(key, keySize);
+          if(node == nullptr) {
+            skipElement(innerCaret, valueType);
+            if(innerCaret.hasError()){
+              caret.inc(innerCaret.getPosition());
+              caret.setError(innerCaret.getErrorMessage(), innerCaret.getErrorCode());
+              return nullptr;
+            }
+            continue;
+          }
+        }
 
-          auto field = fieldIterator->second;
-          if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
-            auto label = innerCaret.putLabel();
+        const FieldPlan* fieldPlan = plan->findField(key, keySize, nextField);
+        if(fieldPlan != nullptr){
+
+          auto field = fieldPlan->property;
+          if(fieldPlan->polymorphic) {
+            const char* data = innerCaret.getCurrData();
             skipElement(innerCaret, valueType);
             if(innerCaret.hasError()){
               caret.inc(innerCaret.getPosition());
@@ -599,10 +1010,19 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer,
             }
             PolymorphData polymorphData;
             polymorphData.field = field;
-            polymorphData.unparsedData = label.toString();
+            polymorphData.data = data;
+            polymorphData.size = innerCaret.getCurrData() - data;
             polymorphData.valueType = valueType;
+            polymorphData.projection = node;
             polymorphs.push_back(polymorphData); // store polymorphs for later processing.
+          } else if(reused && fieldPlan->reuseIndex >= 0) {
+            auto existing = field->get(static_cast<oatpp::BaseObject *>(object.get()));
+            reusedFields |= ((v_uint64) 1) << fieldPlan->reuseIndex;
+            FieldProjection fieldProjection(node);
+            TargetScope targetScope(&existing);
+            field->set(static_cast<oatpp::BaseObject *>(object.get()), deserializer->deserialize(innerCaret, field->type, valueType));
           } else {
+            FieldProjection fieldProjection(node);
             field->set(static_cast<oatpp::BaseObject *>(object.get()),deserializer->deserialize(innerCaret, field->type, valueType));
           }
 
@@ -638,10 +1058,23 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer,
 
       caret.inc(innerCaret.getPosition());
 
+      if(reused) {
+        for(auto& f : plan->fields) {
+          if(f.reuseIndex >= 0 && (reusedFields & (((v_uint64) 1) << f.reuseIndex)) == 0) {
+            f.property->set(static_cast<oatpp::BaseObject *>(object.get()), oatpp::Void(f.property->type));
+          }
+        }
+      }
+
       for(auto& p : polymorphs) {
-        parser::Caret polyCaret(p.unparsedData);
+        parser::Caret polyCaret(p.data, p.size);
         auto selectedType = p.field->info.typeSelector->selectType(static_cast<oatpp::BaseObject *>(object.get()));
+        FieldProjection fieldProjection(p.projection);
         auto value = deserializer->deserialize(polyCaret, selectedType, p.valueType);
+        if(polyCaret.hasError()) {
+          caret.setError(polyCaret.getErrorMessage(), polyCaret.getErrorCode());
+          return nullptr;
+        }
         oatpp::Any any(value);
         p.field->set(static_cast<oatpp::BaseObject *>(object.get()), oatpp::Void(any.getPtr(), p.field->type));
       }
@@ -658,13 +1091,20 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer,
 }
 
 oatpp::Void Deserializer::deserialize(parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode) {
+
+  if(bsonTypeCode == TypeCode::DOCUMENT_ROOT && !m_interpretations.inScope()) {
+    /* Top-level document - select enabled interpretations once for the whole document */
+    InterpretationCache::Scope interpretationsScope(m_interpretations, m_config->enableInterpretations);
+    return deserialize(caret, type, bsonTypeCode);
+  }
+
   auto id = type->classId.id;
   auto& method = m_methods[id];
   if(method) {
     return (*method)(this, caret, type, bsonTypeCode);
   } else {
 
-    auto* interpretation = type->findInterpretation(m_config->enableInterpretations);
+    auto* interpretation = m_interpretations.find(type, m_config->enableInterpretations);
     if(interpretation) {
       return interpretation->fromInterpretation(deserialize(caret, interpretation->getInterpretationType(), bsonTypeCode));
     }
@@ -675,6 +1115,17 @@ oatpp::Void Deserializer::deserialize(parser::Caret& caret, const Type* const ty
   }
 }
 
+void Deserializer::deserializeInto(parser::Caret& caret, const oatpp::Void& object) {
+
+  if(!object || object.getValueType()->classId.id != oatpp::data::mapping::type::__class::AbstractObject::CLASS_ID.id) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Deserializer::deserializeInto()]: Error. Object should be a non-null DTO object.");
+  }
+
+  TargetScope targetScope(&object);
+  deserialize(caret, object.getValueType(), TypeCode::DOCUMENT_ROOT);
+
+}
+
 const std::shared_ptr<Deserializer::Config>& Deserializer::getConfig() {
   return m_config;
 }
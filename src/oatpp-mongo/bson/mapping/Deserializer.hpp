@@ -26,6 +26,11 @@
 #ifndef oatpp_mongo_bson_mapping_Deserializer_hpp
 #define oatpp_mongo_bson_mapping_Deserializer_hpp
 
+#include "InterpretationCache.hpp"
+#include "PlanCache.hpp"
+#include "Projection.hpp"
+
+#include "oatpp-mongo/bson/MonotonicArena.hpp"
 #include "oatpp-mongo/bson/Utils.hpp"
 
 #include "oatpp/core/parser/Caret.hpp"
@@ -71,25 +76,191 @@ public:
     bool allowUnknownFields = true;
 
     /**
-     * Enable type interpretations.
+     * Check that keys of array elements are consecutive indices `"0", "1", "2", ...`. <br>
+     * May be disabled for trusted input (e.g. server responses) - keys of array elements are skipped then.
+     */
+    bool validateArrayIndices = true;
+
+    /**
+     * Enable type interpretations. <br>
+     * Interpretations are resolved once per type for each distinct list and cached.
+     * The list is compared with the cached lists once per top-level call - see &id:oatpp::mongo::bson::mapping::InterpretationCache;.
      */
     std::vector<std::string> enableInterpretations = {};
 
+    /**
+     * Deserialize untyped strings (values of `oatpp::Any`, `oatpp::Fields<oatpp::Any>`, etc.) as
+     * &id:oatpp::mongo::bson::SharedString; referencing the source document instead of copying them
+     * to &id:oatpp::String;. <br>
+     * Fields declared as &id:oatpp::mongo::bson::SharedString; always reference the source document.
+     */
+    bool zeroCopyStrings = false;
+
   };
 
 public:
   typedef oatpp::Void (*DeserializerMethod)(Deserializer*, parser::Caret&, const Type* const, v_char8 bsonTypeCode);
+public:
+
+  /**
+   * Source buffer scope. <br>
+   * While the scope is alive, values deserialized on the current thread from the caret data reference the caret
+   * memory handle instead of copying the data (where supported - see &id:oatpp::mongo::bson::Binary;,
+   * &id:oatpp::mongo::bson::SharedString;). <br>
+   * Has no effect if the caret has no memory handle.
+   */
+  class SourceBufferScope {
+  public:
+    struct SourceBuffer {
+      std::shared_ptr<std::string> handle;
+      const char* data;
+      v_buff_size size;
+    };
+  private:
+    SourceBuffer m_buffer;
+    const SourceBuffer* m_prevBuffer;
+  public:
+
+    SourceBufferScope(parser::Caret& caret);
+    ~SourceBufferScope();
+
+    SourceBufferScope(const SourceBufferScope&) = delete;
+    SourceBufferScope& operator=(const SourceBufferScope&) = delete;
+
+    /**
+     * Get memory handle of the source buffer of the current thread, if it contains the given memory region.
+     * @param data - pointer to data.
+     * @param size - size of data.
+     * @return - memory handle or `nullptr`.
+     */
+    static std::shared_ptr<std::string> getHandle(const char* data, v_buff_size size);
+
+  };
+
+  /**
+   * Projection scope. <br>
+   * While the scope is alive, documents deserialized on the current thread are filtered by the projection -
+   * fields which are not selected are skipped. Applies to DTO objects as well as to maps (`oatpp::Fields<...>`, `oatpp::Any`).
+   * See &id:oatpp::mongo::bson::mapping::Projection;.
+   */
+  class ProjectionScope {
+  private:
+    const Projection::Node* m_prevNode;
+  public:
+
+    /**
+     * Constructor.
+     * @param projection - &id:oatpp::mongo::bson::mapping::Projection;. `nullptr` - no filtering.
+     */
+    ProjectionScope(const Projection* projection);
+    ~ProjectionScope();
+
+    ProjectionScope(const ProjectionScope&) = delete;
+    ProjectionScope& operator=(const ProjectionScope&) = delete;
+
+  };
+
+  /**
+   * Arena scope. <br>
+   * While the scope is alive, primitive values, strings, ObjectIds and inline documents deserialized on the current thread
+   * are allocated from the &id:oatpp::mongo::bson::MonotonicArena; - value and control block in one bump allocation,
+   * all freed together when the last value is released. <br>
+   * DTO objects and containers are created by oatpp dispatchers and are allocated as usual.
+   */
+  class ArenaScope {
+  private:
+    std::shared_ptr<MonotonicArena> m_arena;
+    const std::shared_ptr<MonotonicArena>* m_prevArena;
+  public:
+
+    /**
+     * Constructor.
+     * @param arena - &id:oatpp::mongo::bson::MonotonicArena;.
+     */
+    ArenaScope(const std::shared_ptr<MonotonicArena>& arena);
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+  };
 private:
+  /*
+   * Polymorphic field value deferred until the whole object is parsed - references the source document.
+   */
   struct PolymorphData {
     oatpp::BaseObject::Property* field;
-    oatpp::String unparsedData;
+    const char* data;
+    v_buff_size size;
     v_char8 valueType;
+    const Projection::Node* projection;
+  };
+
+  /*
+   * Field of the DTO class resolved for deserialization.
+   */
+  struct FieldPlan {
+    oatpp::BaseObject::Property* property;
+    const char* name;
+    v_buff_size nameSize;
+    bool polymorphic;
+
+    /*
+     * Bit index of the field in the mask of reused nested objects. -1 - the field value is not reused.
+     */
+    v_int32 reuseIndex;
+  };
+
+  /*
+   * Deserialization plan of the DTO class. Built on first use and cached per Type.
+   */
+  struct ObjectPlan {
+
+    /*
+     * Fields in declaration order.
+     */
+    std::vector<FieldPlan> fields;
+
+    /*
+     * Indices of fields sorted by name size, then by name bytes.
+     */
+    std::vector<v_int32> sortedFields;
+
+    /*
+     * Find field by the raw key. The field at `hint` is checked first - documents written by this library
+     * come in declaration order. On match `hint` is set to the index of the next field.
+     */
+    const FieldPlan* findField(const char* key, v_buff_size keySize, v_int32& hint) const;
+
   };
 private:
   static void skipCString(parser::Caret& caret);
   static void skipSizedElement(parser::Caret& caret, v_int32 additionalBytes = 0);
-  static void skipElement(parser::Caret& caret, v_char8 bsonTypeCode);
   static const Type* guessType(v_char8 bsonTypeCode);
+public:
+
+  /**
+   * Skip BSON element value.
+   * @param caret - &id:oatpp::parser::Caret; positioned at the element value.
+   * @param bsonTypeCode - type code of the element.
+   */
+  static void skipElement(parser::Caret& caret, v_char8 bsonTypeCode);
+private:
+
+  static const std::shared_ptr<MonotonicArena>* getArena();
+
+  /*
+   * Allocate value from the arena of the current ArenaScope, if any.
+   */
+  template<class T, class ... Args>
+  static std::shared_ptr<T> allocateValue(Args&&... args) {
+    auto arena = getArena();
+    if(arena) {
+      return std::allocate_shared<T>(MonotonicArena::Allocator<T>(*arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+
 private:
 
   template<class T>
@@ -104,18 +275,23 @@ private:
 
     typename T::ObjectType value;
     Utils::readPrimitive(caret, value, bsonTypeCode);
-    return T(value);
+    return oatpp::Void(allocateValue<typename T::ObjectType>(value), T::Class::getType());
 
   }
 
   static oatpp::Void deserializeBoolean(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
   static oatpp::Void deserializeDateTime(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
   static oatpp::Void deserializeString(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
+  static oatpp::Void deserializeSharedString(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
 
   static oatpp::Void deserializeInlineDocs(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
 
   static oatpp::Void deserializeObjectId(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
 
+  static oatpp::Void deserializeBinary(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
+
+  static oatpp::Void deserializeDecimal128(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
+
   static oatpp::Void deserializeAny(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
   static oatpp::Void deserializeEnum(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
 
@@ -123,9 +299,14 @@ private:
   static oatpp::Void deserializeMap(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
   static oatpp::Void deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
 
+  const ObjectPlan* getObjectPlan(const Type* type);
+  static std::unique_ptr<ObjectPlan> buildObjectPlan(const Type* type);
+
 private:
   std::shared_ptr<Config> m_config;
   std::vector<DeserializerMethod> m_methods;
+  InterpretationCache m_interpretations;
+  PlanCache<ObjectPlan> m_objectPlans;
 public:
 
   /**
@@ -149,6 +330,16 @@ public:
    */
   oatpp::Void deserialize(parser::Caret& caret, const Type* const type, v_char8 bsonTypeCode);
 
+  /**
+   * Deserialize root document into the existing DTO object instead of creating a new one. <br>
+   * All fields of the object are overwritten - fields missing in the document are set to `nullptr`.
+   * Nested DTO objects are reused the same way.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param object - DTO object to deserialize into.
+   * @throws - `std::runtime_error` if `object` is null or is not a DTO object.
+   */
+  void deserializeInto(parser::Caret& caret, const oatpp::Void& object);
+
   /**
    * Get deserializer config.
    * @return
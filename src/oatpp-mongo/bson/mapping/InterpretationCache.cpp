@@ -0,0 +1,96 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "InterpretationCache.hpp"
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+namespace {
+
+  /*
+   * Innermost InterpretationCache::Scope of the current thread.
+   */
+  thread_local const InterpretationCache::Scope* t_scope = nullptr;
+
+}
+
+InterpretationCache::Scope::Scope(InterpretationCache& cache, const Interpretations& interpretations)
+  : m_cache(&cache)
+  , m_generation(cache.select(interpretations))
+  , m_prev(t_scope)
+{
+  t_scope = this;
+}
+
+InterpretationCache::Scope::~Scope() {
+  t_scope = m_prev;
+}
+
+InterpretationCache::InterpretationCache() {
+  m_generations.emplace_back(new Generation(Interpretations()));
+  m_lastGeneration.store(m_generations.back().get(), std::memory_order_relaxed);
+}
+
+InterpretationCache::Generation* InterpretationCache::select(const Interpretations& interpretations) {
+
+  Generation* generation = m_lastGeneration.load(std::memory_order_acquire);
+  if(generation->interpretations == interpretations) {
+    return generation;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for(auto& g : m_generations) {
+    if(g->interpretations == interpretations) {
+      m_lastGeneration.store(g.get(), std::memory_order_release);
+      return g.get();
+    }
+  }
+
+  m_generations.emplace_back(new Generation(interpretations));
+  generation = m_generations.back().get();
+  m_lastGeneration.store(generation, std::memory_order_release);
+  return generation;
+
+}
+
+bool InterpretationCache::inScope() const {
+  return t_scope != nullptr && t_scope->m_cache == this;
+}
+
+const InterpretationCache::Interpretation* InterpretationCache::find(const Type* type, const Interpretations& interpretations) {
+
+  const Scope* scope = t_scope;
+  Generation* generation = (scope != nullptr && scope->m_cache == this) ? scope->m_generation : select(interpretations);
+
+  const Resolved* resolved = generation->resolved.get(type, [generation](const Type* t) {
+    return std::unique_ptr<Resolved>(new Resolved{t->findInterpretation(generation->interpretations)});
+  });
+
+  return resolved->interpretation;
+
+}
+
+}}}}
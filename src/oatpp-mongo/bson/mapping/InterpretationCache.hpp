@@ -0,0 +1,143 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_mapping_InterpretationCache_hpp
+#define oatpp_mongo_bson_mapping_InterpretationCache_hpp
+
+#include "PlanCache.hpp"
+
+#include "oatpp/core/Types.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+/**
+ * Cache of type interpretations resolved for lists of enabled interpretations. <br>
+ * Each distinct list gets its own table of resolved interpretations keyed by type - see &id:oatpp::mongo::bson::mapping::PlanCache;.
+ * Tables are never rewritten, so mappers using different lists don't invalidate each other. <br>
+ * The list is compared with the cached lists once per top-level call - see &l:InterpretationCache::Scope;.
+ * Lookups outside of a scope compare the list on every lookup. <br>
+ * Thread-safe.
+ */
+class InterpretationCache {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::Type::AbstractInterpretation Interpretation;
+  typedef std::vector<std::string> Interpretations;
+private:
+
+  struct Resolved {
+    const Interpretation* interpretation;
+  };
+
+  /*
+   * Interpretations resolved for one list of enabled interpretations.
+   */
+  struct Generation {
+
+    Generation(const Interpretations& pInterpretations)
+      : interpretations(pInterpretations)
+    {}
+
+    const Interpretations interpretations;
+    PlanCache<Resolved> resolved;
+
+  };
+
+public:
+
+  /**
+   * Scope of a top-level serialize/deserialize call on the current thread. <br>
+   * Selects the table of the list of enabled interpretations once - lookups within the scope don't compare the list.
+   */
+  class Scope {
+    friend InterpretationCache;
+  private:
+    const InterpretationCache* m_cache;
+    Generation* m_generation;
+    const Scope* m_prev;
+  public:
+
+    /**
+     * Constructor.
+     * @param cache - &l:InterpretationCache;.
+     * @param interpretations - list of enabled interpretations (see `Config::enableInterpretations`).
+     */
+    Scope(InterpretationCache& cache, const Interpretations& interpretations);
+
+    /**
+     * Non-copyable.
+     */
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope();
+
+  };
+
+private:
+  std::mutex m_mutex;
+  std::atomic<Generation*> m_lastGeneration;
+  /* Generations are never removed - one per distinct list. */
+  std::vector<std::unique_ptr<Generation>> m_generations;
+private:
+  Generation* select(const Interpretations& interpretations);
+public:
+
+  /**
+   * Constructor.
+   */
+  InterpretationCache();
+
+  /**
+   * Non-copyable.
+   */
+  InterpretationCache(const InterpretationCache&) = delete;
+  InterpretationCache& operator=(const InterpretationCache&) = delete;
+
+  /**
+   * Check if the current thread is within the &l:InterpretationCache::Scope; of this cache.
+   * @return
+   */
+  bool inScope() const;
+
+  /**
+   * Find interpretation of the type. Same as `type->findInterpretation(interpretations)`.
+   * @param type - &id:oatpp::data::mapping::type::Type;.
+   * @param interpretations - list of enabled interpretations (see `Config::enableInterpretations`).
+   * Ignored within the &l:InterpretationCache::Scope; of this cache - the list of the scope is used.
+   * @return - interpretation or `nullptr`.
+   */
+  const Interpretation* find(const Type* type, const Interpretations& interpretations);
+
+};
+
+}}}}
+
+#endif /* oatpp_mongo_bson_mapping_InterpretationCache_hpp */
@@ -0,0 +1,122 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "LazyDocument.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+LazyDocument::LazyDocument(const InlineDocument& document, const std::shared_ptr<Deserializer>& deserializer)
+  : m_document(document)
+  , m_deserializer(deserializer)
+{}
+
+const LazyDocument::CachedField* LazyDocument::findCached(const char* key, v_buff_size keySize, const Type* type) const {
+  for(auto& field : m_fields) {
+    if(field.type == type && field.key->size() == keySize && std::memcmp(field.key->data(), key, keySize) == 0) {
+      return &field;
+    }
+  }
+  return nullptr;
+}
+
+bool LazyDocument::findValue(parser::Caret& caret, const char* key, v_buff_size keySize, v_char8& valueTypeCode) const {
+
+  v_int32 docSize = Utils::readInt32(caret);
+  if(docSize < 5 || docSize != caret.getDataSize()) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::LazyDocument::findValue()]: Error. Invalid document size.");
+  }
+
+  while(caret.canContinue() && caret.getPosition() < caret.getDataSize() - 1) {
+
+    v_buff_size currKeySize;
+    const char* currKey = Utils::readKeyInPlace(caret, valueTypeCode, currKeySize);
+    if(caret.hasError()) {
+      break;
+    }
+
+    if(currKeySize == keySize && std::memcmp(currKey, key, keySize) == 0) {
+      return true;
+    }
+
+    Deserializer::skipElement(caret, valueTypeCode);
+
+  }
+
+  if(caret.hasError()) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::LazyDocument::findValue()]: Error. " + std::string(caret.getErrorMessage()));
+  }
+
+  return false;
+
+}
+
+oatpp::Void LazyDocument::get(const oatpp::String& key, const Type* type) {
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::LazyDocument::get()]: Error. Key can't be null.");
+  }
+
+  auto cached = findCached(key->data(), key->size(), type);
+  if(cached) {
+    return cached->value;
+  }
+
+  if(!m_document) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::LazyDocument::get()]: Error. Document is null.");
+  }
+
+  oatpp::Void value(type);
+
+  parser::Caret caret(oatpp::String(m_document.getPtr()));
+  v_char8 valueTypeCode;
+  if(findValue(caret, key->data(), key->size(), valueTypeCode)) {
+    Deserializer::SourceBufferScope sourceBufferScope(caret);
+    value = m_deserializer->deserialize(caret, type, valueTypeCode);
+    if(caret.hasError()) {
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::LazyDocument::get()]: Error. " + std::string(caret.getErrorMessage()));
+    }
+  }
+
+  m_fields.push_back({key, type, value});
+  return value;
+
+}
+
+bool LazyDocument::hasField(const oatpp::String& key) const {
+  if(!key || !m_document) {
+    return false;
+  }
+  parser::Caret caret(oatpp::String(m_document.getPtr()));
+  v_char8 valueTypeCode;
+  return findValue(caret, key->data(), key->size(), valueTypeCode);
+}
+
+const InlineDocument& LazyDocument::getDocument() const {
+  return m_document;
+}
+
+}}}}
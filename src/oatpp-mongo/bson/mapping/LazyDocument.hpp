@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_mapping_LazyDocument_hpp
+#define oatpp_mongo_bson_mapping_LazyDocument_hpp
+
+#include "./Deserializer.hpp"
+
+#include "oatpp-mongo/bson/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+/**
+ * Lazy view over a BSON document. <br>
+ * Fields are located and deserialized only when they are first accessed. Decoded values are cached. <br>
+ * Use it when just a few fields of a large document are needed - unlike &id:oatpp::mongo::bson::mapping::ObjectMapper::read;
+ * the rest of the document is skipped without building the object graph. <br>
+ * Binary and &id:oatpp::mongo::bson::SharedString; values reference the document instead of copying it. <br>
+ * *Not thread-safe.* <br>
+ * Usage:
+ * ```cpp
+ * LazyDocument user(document, mapper.getDeserializer()); // document is bson::InlineDocument
+ * auto name = user.get<oatpp::String>("name");
+ * auto age = user.get<oatpp::Int32>("age");
+ * ```
+ */
+class LazyDocument {
+private:
+
+  struct CachedField {
+    oatpp::String key;
+    const Type* type;
+    oatpp::Void value;
+  };
+
+private:
+  const CachedField* findCached(const char* key, v_buff_size keySize, const Type* type) const;
+  bool findValue(parser::Caret& caret, const char* key, v_buff_size keySize, v_char8& valueTypeCode) const;
+private:
+  InlineDocument m_document;
+  std::shared_ptr<Deserializer> m_deserializer;
+  std::vector<CachedField> m_fields;
+public:
+
+  /**
+   * Constructor.
+   * @param document - BSON document &id:oatpp::mongo::bson::InlineDocument;.
+   * @param deserializer - &id:oatpp::mongo::bson::mapping::Deserializer; used to decode fields.
+   */
+  LazyDocument(const InlineDocument& document,
+               const std::shared_ptr<Deserializer>& deserializer = std::make_shared<Deserializer>());
+
+  /**
+   * Get field value. The field is deserialized on the first call and cached.
+   * @param key - BSON key of the field.
+   * @param type - type of the field value &id:oatpp::data::mapping::type::Type;.
+   * @return - &id:oatpp::Void; holding field value. `nullptr` (of the given type) if there is no such field.
+   * @throws - `std::runtime_error` if the document or the field value is invalid.
+   */
+  oatpp::Void get(const oatpp::String& key, const Type* type);
+
+  /**
+   * Get field value. The field is deserialized on the first call and cached.
+   * @tparam Wrapper - type of the field value. Ex.: `oatpp::String`, `oatpp::Object<MyDto>`.
+   * @param key - BSON key of the field.
+   * @return - field value. `nullptr` if there is no such field.
+   * @throws - `std::runtime_error` if the document or the field value is invalid.
+   */
+  template<class Wrapper>
+  Wrapper get(const oatpp::String& key) {
+    return get(key, Wrapper::Class::getType()).template cast<Wrapper>();
+  }
+
+  /**
+   * Check if document has the field. Doesn't deserialize the field.
+   * @param key - BSON key of the field.
+   * @return
+   */
+  bool hasField(const oatpp::String& key) const;
+
+  /**
+   * Get the underlying BSON document.
+   * @return - &id:oatpp::mongo::bson::InlineDocument;.
+   */
+  const InlineDocument& getDocument() const;
+
+};
+
+}}}}
+
+#endif // oatpp_mongo_bson_mapping_LazyDocument_hpp
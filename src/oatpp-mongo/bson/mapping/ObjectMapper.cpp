@@ -25,6 +25,8 @@
 
 #include "ObjectMapper.hpp"
 
+#include "oatpp-mongo/bson/BufferArena.hpp"
+
 namespace oatpp { namespace mongo { namespace bson { namespace mapping {
 
 ObjectMapper::ObjectMapper(const std::shared_ptr<Serializer::Config>& serializerConfig,
@@ -57,9 +59,42 @@ void ObjectMapper::write(data::stream::ConsistentOutputStream* stream,
 }
 
 oatpp::Void ObjectMapper::read(oatpp::parser::Caret& caret, const oatpp::data::mapping::type::Type* const type) const {
+  Deserializer::SourceBufferScope sourceBufferScope(caret);
   return m_deserializer->deserialize(caret, type, TypeCode::DOCUMENT_ROOT);
 }
 
+void ObjectMapper::readInto(const oatpp::Void& object, oatpp::parser::Caret& caret) const {
+  Deserializer::SourceBufferScope sourceBufferScope(caret);
+  m_deserializer->deserializeInto(caret, object);
+}
+
+oatpp::Void ObjectMapper::read(oatpp::parser::Caret& caret,
+                               const oatpp::data::mapping::type::Type* const type,
+                               const Projection& projection) const
+{
+  Deserializer::SourceBufferScope sourceBufferScope(caret);
+  Deserializer::ProjectionScope projectionScope(&projection);
+  return m_deserializer->deserialize(caret, type, TypeCode::DOCUMENT_ROOT);
+}
+
+v_buff_size ObjectMapper::computeSize(const oatpp::Void& variant) const {
+  return m_serializer->computeSize(variant);
+}
+
+oatpp::String ObjectMapper::writeToStringPooled(const oatpp::Void& variant) const {
+  auto stream = BufferArena::getThreadLocal().borrow();
+  m_serializer->serializeToStream(stream.get(), variant);
+  return stream->toString();
+}
+
+void ObjectMapper::writeToSlices(bson::SliceList* slices, const oatpp::Void& variant) const {
+  m_serializer->serializeToSlices(slices, variant);
+}
+
+v_buff_size ObjectMapper::writeToBuffer(void* buffer, v_buff_size capacity, const oatpp::Void& variant) const {
+  return m_serializer->serializeToBuffer(buffer, capacity, variant);
+}
+
 std::shared_ptr<Serializer> ObjectMapper::getSerializer() {
   return m_serializer;
 }
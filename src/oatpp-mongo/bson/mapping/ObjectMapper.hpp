@@ -93,13 +93,87 @@ public:
   void write(data::stream::ConsistentOutputStream* stream, const oatpp::Void& variant) const override;
 
   /**
-   * Implementation of &id:oatpp::data::mapping::ObjectMapper::read;.
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::read;. <br>
+   * Binary values reference the caret memory handle instead of being copied -
+   * see &id:oatpp::mongo::bson::mapping::Deserializer::SourceBufferScope;.
    * @param caret - &id:oatpp::parser::Caret;.
    * @param type - type of resultant object &id:oatpp::data::mapping::type::Type;.
    * @return - &id:oatpp::Void; holding resultant object.
    */
   oatpp::Void read(oatpp::parser::Caret& caret, const oatpp::data::mapping::type::Type* const type) const override;
 
+  /**
+   * Deserialize BSON document into the existing DTO object. The object and its nested DTO objects are reused
+   * instead of being allocated - see &id:oatpp::mongo::bson::mapping::Deserializer::deserializeInto;. <br>
+   * Use with &id:oatpp::mongo::bson::mapping::ObjectPool; to recycle objects when processing documents one at a time.
+   * @param object - DTO object to deserialize into.
+   * @param caret - &id:oatpp::parser::Caret;.
+   */
+  void readInto(const oatpp::Void& object, oatpp::parser::Caret& caret) const;
+
+  /**
+   * Deserialize only the fields selected by the projection. Other fields are skipped and left `nullptr`
+   * (or default value). See &id:oatpp::mongo::bson::mapping::Projection;.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param type - type of resultant object &id:oatpp::data::mapping::type::Type;.
+   * @param projection - &id:oatpp::mongo::bson::mapping::Projection;.
+   * @return - &id:oatpp::Void; holding resultant object.
+   */
+  oatpp::Void read(oatpp::parser::Caret& caret, const oatpp::data::mapping::type::Type* const type, const Projection& projection) const;
+
+  /**
+   * Deserialize only the fields selected by the projection.
+   * @tparam Wrapper - ObjectWrapper type.
+   * @param str - BSON document.
+   * @param projection - &id:oatpp::mongo::bson::mapping::Projection;.
+   * @return - deserialized object.
+   * @throws - `std::runtime_error` if the document is invalid.
+   */
+  template<class Wrapper>
+  Wrapper readProjected(const oatpp::String& str, const Projection& projection) const {
+    oatpp::parser::Caret caret(str);
+    auto result = read(caret, Wrapper::Class::getType(), projection).template cast<Wrapper>();
+    if(caret.hasError()) {
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::ObjectMapper::readProjected()]: Error. " + std::string(caret.getErrorMessage()));
+    }
+    return result;
+  }
+
+  /**
+   * Compute the exact size of BSON document without serializing it.
+   * See &id:oatpp::mongo::bson::mapping::Serializer::computeSize;.
+   * @param variant - object to measure &id:oatpp::Void;.
+   * @return - size of BSON document in bytes.
+   */
+  v_buff_size computeSize(const oatpp::Void& variant) const;
+
+  /**
+   * Serialize object to BSON string. Same output as `writeToString()`. <br>
+   * Serializes to the scratch buffer borrowed from &id:oatpp::mongo::bson::BufferArena; of the current thread.
+   * The scratch buffer keeps its capacity between calls, so no size pre-pass is made -
+   * use &l:ObjectMapper::computeSize (); where the exact size is needed up front.
+   * @param variant - object to serialize &id:oatpp::Void;.
+   * @return - BSON document as &id:oatpp::String;.
+   */
+  oatpp::String writeToStringPooled(const oatpp::Void& variant) const;
+
+  /**
+   * Serialize object and append it to &id:oatpp::mongo::bson::SliceList;.
+   * See &id:oatpp::mongo::bson::mapping::Serializer::serializeToSlices;.
+   * @param slices - &id:oatpp::mongo::bson::SliceList;.
+   * @param variant - object to serialize &id:oatpp::Void;.
+   */
+  void writeToSlices(bson::SliceList* slices, const oatpp::Void& variant) const;
+
+  /**
+   * Serialize object to the caller-owned memory region.
+   * See &id:oatpp::mongo::bson::mapping::Serializer::serializeToBuffer;.
+   * @param buffer - pointer to memory region.
+   * @param capacity - size of memory region.
+   * @param variant - object to serialize &id:oatpp::Void;.
+   * @return - size of BSON document in bytes. If greater than `capacity` - the content of `buffer` is unspecified.
+   */
+  v_buff_size writeToBuffer(void* buffer, v_buff_size capacity, const oatpp::Void& variant) const;
 
   /**
    * Get serializer.
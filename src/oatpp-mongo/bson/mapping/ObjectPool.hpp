@@ -0,0 +1,114 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_mapping_ObjectPool_hpp
+#define oatpp_mongo_bson_mapping_ObjectPool_hpp
+
+#include "oatpp/core/Types.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+/**
+ * Pool of DTO objects of one type. <br>
+ * Objects are recycled with &id:oatpp::mongo::bson::mapping::ObjectMapper::readInto; instead of allocating
+ * a new object for every document. <br>
+ * Usage:
+ * ```cpp
+ * ObjectPool<User> pool(16);
+ * while(...) {
+ *   auto user = pool.acquire();
+ *   mapper.readInto(user, caret);
+ *   ...
+ *   pool.release(user);
+ * }
+ * ```
+ * @tparam T - DTO class.
+ */
+template<class T>
+class ObjectPool {
+private:
+  std::mutex m_mutex;
+  std::vector<oatpp::Object<T>> m_objects;
+  v_buff_size m_capacity;
+public:
+
+  /**
+   * Constructor.
+   * @param capacity - max number of objects kept in the pool.
+   */
+  ObjectPool(v_buff_size capacity)
+    : m_capacity(capacity)
+  {}
+
+  /**
+   * Get object from the pool. A new object is created if the pool is empty. <br>
+   * Recycled objects keep the state of the last document until they are overwritten.
+   * @return - `oatpp::Object<T>`.
+   */
+  oatpp::Object<T> acquire() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(!m_objects.empty()) {
+        auto object = m_objects.back();
+        m_objects.pop_back();
+        return object;
+      }
+    }
+    return T::createShared();
+  }
+
+  /**
+   * Return object to the pool. <br>
+   * The object is dropped if the pool is full or if the object is still referenced elsewhere.
+   * @param object - object to return. The caller's reference is reset.
+   */
+  void release(oatpp::Object<T>& object) {
+    auto ptr = object.getPtr();
+    object = nullptr;
+    if(ptr && ptr.use_count() == 1) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if((v_buff_size) m_objects.size() < m_capacity) {
+        m_objects.push_back(oatpp::Object<T>(ptr));
+      }
+    }
+  }
+
+  /**
+   * Get number of objects in the pool.
+   * @return
+   */
+  v_buff_size getSize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (v_buff_size) m_objects.size();
+  }
+
+};
+
+}}}}
+
+#endif // oatpp_mongo_bson_mapping_ObjectPool_hpp
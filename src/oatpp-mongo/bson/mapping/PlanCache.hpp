@@ -0,0 +1,203 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+#ifndef oatpp_mongo_bson_mapping_PlanCache_hpp
+#define oatpp_mongo_bson_mapping_PlanCache_hpp
+
+#include "oatpp/core/Types.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+/**
+ * Read-mostly cache of per-type plans. <br>
+ * Plans are stored in an open-addressing hash table keyed by type. Readers probe the table published through
+ * an atomic pointer - no lock is taken for cached plans. A miss builds the plan under the lock and inserts it in place.
+ * Once the table is half full it is replaced by a table of double capacity. <br>
+ * Replaced tables and plans are kept until the cache is destroyed since concurrent readers may still use them.
+ * Tables grow geometrically, so replaced tables never take more memory than the current one. <br>
+ * Thread-safe.
+ * @tparam Plan - plan type.
+ */
+template<class Plan>
+class PlanCache {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+private:
+
+  static constexpr v_buff_size INITIAL_CAPACITY = 16;
+
+  struct Slot {
+    std::atomic<const Type*> type;
+    std::atomic<const Plan*> plan;
+  };
+
+  struct Table {
+
+    Table(v_buff_size capacity)
+      : slots(new Slot[capacity])
+      , mask(capacity - 1)
+      , count(0)
+    {
+      for(v_buff_size i = 0; i < capacity; i ++) {
+        slots[i].type.store(nullptr, std::memory_order_relaxed);
+        slots[i].plan.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    v_buff_size mask;
+    v_buff_size count; // modified under the lock only.
+
+  };
+
+private:
+
+  static v_buff_size hash(const Type* type) {
+    v_uint64 h = (v_uint64) reinterpret_cast<std::uintptr_t>(type);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (v_buff_size) h;
+  }
+
+  /*
+   * Plan is stored before the type is published - readers which see the type see the plan.
+   */
+  static void insert(Table* table, const Type* type, const Plan* plan) {
+    v_buff_size index = hash(type) & table->mask;
+    while(table->slots[index].type.load(std::memory_order_relaxed) != nullptr) {
+      index = (index + 1) & table->mask;
+    }
+    table->slots[index].plan.store(plan, std::memory_order_relaxed);
+    table->slots[index].type.store(type, std::memory_order_release);
+    table->count ++;
+  }
+
+  static const Plan* find(const Table* table, const Type* type) {
+    v_buff_size index = hash(type) & table->mask;
+    while(true) {
+      const Type* slotType = table->slots[index].type.load(std::memory_order_acquire);
+      if(slotType == type) {
+        return table->slots[index].plan.load(std::memory_order_relaxed);
+      }
+      if(slotType == nullptr) {
+        return nullptr;
+      }
+      index = (index + 1) & table->mask;
+    }
+  }
+
+private:
+  std::atomic<Table*> m_table;
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<Table>> m_tables;
+  std::vector<std::unique_ptr<const Plan>> m_plans;
+private:
+
+  void publish(Table* table) {
+    m_tables.emplace_back(table);
+    m_table.store(table, std::memory_order_release);
+  }
+
+public:
+
+  /**
+   * Constructor.
+   */
+  PlanCache() {
+    publish(new Table(INITIAL_CAPACITY));
+  }
+
+  /**
+   * Non-copyable.
+   */
+  PlanCache(const PlanCache&) = delete;
+  PlanCache& operator=(const PlanCache&) = delete;
+
+  /**
+   * Get cached plan of the type or build it.
+   * @tparam Builder - `std::unique_ptr<Plan> (const Type*)` callable.
+   * @param type - &id:oatpp::data::mapping::type::Type;.
+   * @param builder - called under the lock if the plan of the type is not cached.
+   * @return - plan. Valid until the cache is destroyed.
+   */
+  template<class Builder>
+  const Plan* get(const Type* type, const Builder& builder) {
+
+    const Plan* plan = find(m_table.load(std::memory_order_acquire), type);
+    if(plan != nullptr) {
+      return plan;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Table* table = m_table.load(std::memory_order_relaxed);
+    plan = find(table, type);
+    if(plan != nullptr) {
+      return plan;
+    }
+
+    m_plans.push_back(builder(type));
+    plan = m_plans.back().get();
+
+    if((table->count + 1) * 2 > table->mask + 1) {
+      Table* grown = new Table((table->mask + 1) * 2);
+      for(v_buff_size i = 0; i <= table->mask; i ++) {
+        const Type* slotType = table->slots[i].type.load(std::memory_order_relaxed);
+        if(slotType != nullptr) {
+          insert(grown, slotType, table->slots[i].plan.load(std::memory_order_relaxed));
+        }
+      }
+      insert(grown, type, plan);
+      publish(grown);
+    } else {
+      insert(table, type, plan);
+    }
+
+    return plan;
+
+  }
+
+  /**
+   * Drop all cached plans - next &l:PlanCache::get (); rebuilds them. <br>
+   * Plans returned earlier stay valid. Does nothing if no plans are cached.
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_table.load(std::memory_order_relaxed)->count > 0) {
+      publish(new Table(INITIAL_CAPACITY));
+    }
+  }
+
+};
+
+}}}}
+
+#endif /* oatpp_mongo_bson_mapping_PlanCache_hpp */
@@ -0,0 +1,112 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Projection.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Projection::Node
+
+Projection::Node::Node(const std::string& name)
+  : m_name(name)
+  , m_whole(false)
+{}
+
+Projection::Node* Projection::Node::addChild(const char* name, v_buff_size nameSize) {
+  for(auto& child : m_children) {
+    if(child->m_name.size() == nameSize && std::memcmp(child->m_name.data(), name, nameSize) == 0) {
+      return child.get();
+    }
+  }
+  m_children.push_back(std::unique_ptr<Node>(new Node(std::string(name, nameSize))));
+  return m_children.back().get();
+}
+
+const Projection::Node* Projection::Node::findChild(const char* key, v_buff_size keySize) const {
+  for(auto& child : m_children) {
+    if(child->m_name.size() == keySize && std::memcmp(child->m_name.data(), key, keySize) == 0) {
+      return child.get();
+    }
+  }
+  return nullptr;
+}
+
+bool Projection::Node::isWhole() const {
+  return m_whole;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Projection
+
+Projection::Projection(const std::vector<oatpp::String>& paths)
+  : m_root("")
+{
+
+  for(auto& path : paths) {
+
+    if(!path || path->empty()) {
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::Projection::Projection()]: Error. Empty path.");
+    }
+
+    Node* node = &m_root;
+    const char* data = path->data();
+    v_buff_size size = path->size();
+    v_buff_size begin = 0;
+
+    while(!node->m_whole) {
+
+      v_buff_size end = begin;
+      while(end < size && data[end] != '.') {
+        end ++;
+      }
+
+      if(end == begin) {
+        throw std::runtime_error("[oatpp::mongo::bson::mapping::Projection::Projection()]: Error. Empty key in path '" + *path + "'.");
+      }
+
+      node = node->addChild(data + begin, end - begin);
+
+      if(end == size) {
+        node->m_whole = true;
+        node->m_children.clear();
+        break;
+      }
+
+      begin = end + 1;
+
+    }
+
+  }
+
+}
+
+const Projection::Node* Projection::getRoot() const {
+  return &m_root;
+}
+
+}}}}
@@ -0,0 +1,103 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_mapping_Projection_hpp
+#define oatpp_mongo_bson_mapping_Projection_hpp
+
+#include "oatpp/core/Types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+/**
+ * Set of field paths to deserialize - `{"a", "b.c", "items.price"}`. <br>
+ * Paths are made of BSON keys separated by dots. Arrays are transparent - `"items.price"` selects
+ * the `price` field of every element of the `items` array. <br>
+ * Fields which are not selected are skipped by the &id:oatpp::mongo::bson::mapping::Deserializer; and left `nullptr`
+ * (or default value) in the resultant object.
+ * See &id:oatpp::mongo::bson::mapping::ObjectMapper::read;.
+ */
+class Projection {
+public:
+
+  /**
+   * Node of the projection tree.
+   */
+  class Node {
+    friend Projection;
+  private:
+    std::string m_name;
+    std::vector<std::unique_ptr<Node>> m_children;
+    bool m_whole;
+  private:
+    Node* addChild(const char* name, v_buff_size nameSize);
+  public:
+
+    /**
+     * Constructor.
+     * @param name - BSON key.
+     */
+    Node(const std::string& name);
+
+    /**
+     * Find child node by the raw BSON key.
+     * @param key - pointer to key data.
+     * @param keySize - size of the key.
+     * @return - child node or `nullptr` if the field is not selected.
+     */
+    const Node* findChild(const char* key, v_buff_size keySize) const;
+
+    /**
+     * Check if the whole value is selected - no filtering applies to its nested fields.
+     * @return
+     */
+    bool isWhole() const;
+
+  };
+
+private:
+  Node m_root;
+public:
+
+  /**
+   * Constructor.
+   * @param paths - field paths.
+   * @throws - `std::runtime_error` if a path is empty or contains an empty key.
+   */
+  Projection(const std::vector<oatpp::String>& paths);
+
+  /**
+   * Get root node of the projection tree.
+   * @return
+   */
+  const Node* getRoot() const;
+
+};
+
+}}}}
+
+#endif // oatpp_mongo_bson_mapping_Projection_hpp
@@ -25,8 +25,14 @@
 
 #include "Serializer.hpp"
 
+#include "oatpp-mongo/bson/BufferArena.hpp"
+#include "oatpp-mongo/bson/WorkerPool.hpp"
+
 #include "oatpp/core/parser/Caret.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace oatpp { namespace mongo { namespace bson { namespace mapping {
 
 Serializer::Serializer(const std::shared_ptr<Config>& config)
@@ -77,6 +83,57 @@ Serializer::Serializer(const std::shared_ptr<Config>& config)
 
   setSerializerMethod(oatpp::mongo::bson::__class::DateTime::CLASS_ID, &Serializer::serializeDateTime);
 
+  setSerializerMethod(oatpp::mongo::bson::__class::Binary::CLASS_ID, &Serializer::serializeBinary);
+
+  setSerializerMethod(oatpp::mongo::bson::__class::Decimal128::CLASS_ID, &Serializer::serializeDecimal128);
+
+  setSerializerMethod(oatpp::mongo::bson::__class::SharedString::CLASS_ID, &Serializer::serializeSharedString);
+
+  //----------------
+  // Size
+
+  setSizeMethod(data::mapping::type::__class::String::CLASS_ID, &Serializer::computeStringSize);
+
+  setSizeMethod(data::mapping::type::__class::Int8::CLASS_ID, &Serializer::computePrimitiveSize<4>);
+  setSizeMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Serializer::computePrimitiveSize<4>);
+
+  setSizeMethod(data::mapping::type::__class::Int16::CLASS_ID, &Serializer::computePrimitiveSize<4>);
+  setSizeMethod(data::mapping::type::__class::UInt16::CLASS_ID, &Serializer::computePrimitiveSize<4>);
+
+  setSizeMethod(data::mapping::type::__class::Int32::CLASS_ID, &Serializer::computePrimitiveSize<4>);
+  setSizeMethod(data::mapping::type::__class::UInt32::CLASS_ID, &Serializer::computePrimitiveSize<8>);
+
+  setSizeMethod(data::mapping::type::__class::Int64::CLASS_ID, &Serializer::computePrimitiveSize<8>);
+  setSizeMethod(data::mapping::type::__class::UInt64::CLASS_ID, &Serializer::computePrimitiveSize<8>);
+
+  setSizeMethod(data::mapping::type::__class::Float32::CLASS_ID, &Serializer::computePrimitiveSize<8>);
+  setSizeMethod(data::mapping::type::__class::Float64::CLASS_ID, &Serializer::computePrimitiveSize<8>);
+  setSizeMethod(data::mapping::type::__class::Boolean::CLASS_ID, &Serializer::computePrimitiveSize<1>);
+
+  setSizeMethod(data::mapping::type::__class::Any::CLASS_ID, &Serializer::computeAnySize);
+  setSizeMethod(data::mapping::type::__class::AbstractEnum::CLASS_ID, &Serializer::computeEnumSize);
+  setSizeMethod(data::mapping::type::__class::AbstractObject::CLASS_ID, &Serializer::computeObjectSize);
+
+  setSizeMethod(data::mapping::type::__class::AbstractVector::CLASS_ID, &Serializer::computeCollectionSize);
+  setSizeMethod(data::mapping::type::__class::AbstractList::CLASS_ID, &Serializer::computeCollectionSize);
+  setSizeMethod(data::mapping::type::__class::AbstractUnorderedSet::CLASS_ID, &Serializer::computeCollectionSize);
+
+  setSizeMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Serializer::computeMapSize);
+  setSizeMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Serializer::computeMapSize);
+
+  setSizeMethod(oatpp::mongo::bson::__class::InlineDocument::CLASS_ID, &Serializer::computeInlineDocsSize);
+  setSizeMethod(oatpp::mongo::bson::__class::InlineArray::CLASS_ID, &Serializer::computeInlineDocsSize);
+
+  setSizeMethod(oatpp::mongo::bson::__class::ObjectId::CLASS_ID, &Serializer::computePrimitiveSize<type::ObjectId::DATA_SIZE>);
+
+  setSizeMethod(oatpp::mongo::bson::__class::DateTime::CLASS_ID, &Serializer::computePrimitiveSize<8>);
+
+  setSizeMethod(oatpp::mongo::bson::__class::Binary::CLASS_ID, &Serializer::computeBinarySize);
+
+  setSizeMethod(oatpp::mongo::bson::__class::Decimal128::CLASS_ID, &Serializer::computePrimitiveSize<type::Decimal128::DATA_SIZE>);
+
+  setSizeMethod(oatpp::mongo::bson::__class::SharedString::CLASS_ID, &Serializer::computeSharedStringSize);
+
 }
 
 void Serializer::setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method) {
@@ -85,6 +142,201 @@ void Serializer::setSerializerMethod(const data::mapping::type::ClassId& classId
     m_methods.resize(id + 1, nullptr);
   }
   m_methods[id] = method;
+  if(id < m_sizeMethods.size()) {
+    m_sizeMethods[id] = nullptr; // size of custom serialized types is measured by serializing them
+  }
+  m_objectPlans.clear(); // plans hold resolved methods
+}
+
+void Serializer::setSizeMethod(const data::mapping::type::ClassId& classId, SizeMethod method) {
+  const v_uint32 id = classId.id;
+  if(id >= m_sizeMethods.size()) {
+    m_sizeMethods.resize(id + 1, nullptr);
+  }
+  m_sizeMethods[id] = method;
+}
+
+const Serializer::ObjectPlan* Serializer::getObjectPlan(const Type* type) {
+  return m_objectPlans.get(type, [this](const Type* type) { return buildObjectPlan(type); });
+}
+
+std::unique_ptr<Serializer::ObjectPlan> Serializer::buildObjectPlan(const Type* type) {
+
+  auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  std::unique_ptr<ObjectPlan> plan(new ObjectPlan());
+
+  for(auto const& field : dispatcher->getProperties()->getList()) {
+
+    FieldPlan fieldPlan;
+    fieldPlan.property = field;
+    fieldPlan.key = data::share::StringKeyLabel(nullptr, field->name, std::strlen(field->name));
+    fieldPlan.polymorphic = field->info.typeSelector && field->type == oatpp::Any::Class::getType();
+    fieldPlan.method = nullptr;
+    fieldPlan.sizeMethod = nullptr;
+
+    const v_uint32 id = field->type->classId.id;
+    if(!fieldPlan.polymorphic && id < m_methods.size()) {
+      fieldPlan.method = m_methods[id];
+    }
+    if(!fieldPlan.polymorphic && id < m_sizeMethods.size()) {
+      fieldPlan.sizeMethod = m_sizeMethods[id];
+    }
+
+    plan->fields.push_back(fieldPlan);
+
+  }
+
+  return plan;
+
+}
+
+namespace {
+
+  /*
+   * SliceList the current thread serializes to. See `Serializer::serializeToSlices()`.
+   */
+  thread_local bson::SliceList* t_slices = nullptr;
+
+  class SlicesGuard {
+  private:
+    bson::SliceList* m_prev;
+  public:
+    SlicesGuard(bson::SliceList* slices) : m_prev(t_slices) { t_slices = slices; }
+    ~SlicesGuard() { t_slices = m_prev; }
+  };
+
+  /*
+   * Nested serialization to another stream (ex.: custom serializer methods) must not reference data.
+   */
+  bson::SliceList* getSlices(data::stream::ConsistentOutputStream* stream) {
+    if(t_slices && t_slices->getScratchStream() == stream) {
+      return t_slices;
+    }
+    return nullptr;
+  }
+
+  /*
+   * Stream over the caller-owned memory region. See `Serializer::serializeToBuffer()`.
+   * Data past the capacity is not written but counted - the position is the size required for the document.
+   */
+  class FixedBufferStream : public data::stream::ConsistentOutputStream {
+  private:
+    p_char8 m_data;
+    v_buff_size m_capacity;
+    v_buff_size m_position;
+    data::stream::IOMode m_ioMode;
+  public:
+
+    FixedBufferStream(void* data, v_buff_size capacity)
+      : m_data((p_char8) data)
+      , m_capacity(capacity)
+      , m_position(0)
+      , m_ioMode(data::stream::IOMode::BLOCKING)
+    {}
+
+    v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+      (void) action;
+      if(m_position < m_capacity) {
+        std::memcpy(m_data + m_position, data, (size_t) std::min(count, m_capacity - m_position));
+      }
+      m_position += count;
+      return count;
+    }
+
+    void setOutputStreamIOMode(data::stream::IOMode ioMode) override {
+      m_ioMode = ioMode;
+    }
+
+    data::stream::IOMode getOutputStreamIOMode() override {
+      return m_ioMode;
+    }
+
+    data::stream::Context& getOutputStreamContext() override {
+      static data::stream::DefaultInitializedContext context(data::stream::StreamType::STREAM_INFINITE);
+      return context;
+    }
+
+    /*
+     * Overwrite already counted bytes - ex.: the document length. Bytes past the capacity are skipped.
+     */
+    void writeAt(v_buff_size position, v_int32 value) {
+      if(position + 4 <= m_capacity) {
+        bson::Utils::writeInt32(m_data + position, value);
+      }
+    }
+
+    v_buff_size getCurrentPosition() const {
+      return m_position;
+    }
+
+  };
+
+  /*
+   * Lengths of documents are patched in place - documents are written only to a buffer or to FixedBufferStream.
+   * Other streams are written via Serializer::serializeToStream() which serializes to a temporary buffer first.
+   */
+  void throwNotDocumentStream() {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::beginDocument()]: Error. "
+                             "Documents can only be written to data::stream::BufferOutputStream - use serializeToStream().");
+  }
+
+}
+
+v_buff_size Serializer::beginDocument(data::stream::ConsistentOutputStream* stream) {
+
+  auto buffer = dynamic_cast<data::stream::BufferOutputStream*>(stream);
+  if(buffer) {
+    v_buff_size lengthPosition = buffer->getCurrentPosition();
+    auto slices = getSlices(stream);
+    bson::Utils::writeInt32(stream, slices ? (v_int32) (v_uint32) slices->getReferencedSize() : 0);
+    return lengthPosition;
+  }
+
+  auto fixedBuffer = dynamic_cast<FixedBufferStream*>(stream);
+  if(fixedBuffer) {
+    v_buff_size lengthPosition = fixedBuffer->getCurrentPosition();
+    bson::Utils::writeInt32(stream, 0);
+    return lengthPosition;
+  }
+
+  throwNotDocumentStream();
+  return 0;
+
+}
+
+void Serializer::endDocument(data::stream::ConsistentOutputStream* stream, v_buff_size lengthPosition) {
+
+  stream->writeCharSimple(0);
+
+  auto buffer = dynamic_cast<data::stream::BufferOutputStream*>(stream);
+  if(buffer == nullptr) {
+    auto fixedBuffer = dynamic_cast<FixedBufferStream*>(stream);
+    if(fixedBuffer == nullptr) {
+      throwNotDocumentStream();
+    }
+    fixedBuffer->writeAt(lengthPosition, (v_int32) (fixedBuffer->getCurrentPosition() - lengthPosition));
+    return;
+  }
+
+  v_int32 length = (v_int32) (buffer->getCurrentPosition() - lengthPosition);
+
+  auto slices = getSlices(stream);
+  if(slices) {
+    oatpp::parser::Caret caret((const char*) buffer->getData() + lengthPosition, 4);
+    v_uint32 referencedAtBegin = (v_uint32) bson::Utils::readInt32(caret);
+    length += (v_int32) ((v_uint32) slices->getReferencedSize() - referencedAtBegin);
+  }
+
+  bson::Utils::writeInt32(buffer->getData() + lengthPosition, length);
+
+}
+
+oatpp::Void Serializer::getFieldValue(const FieldPlan& field, oatpp::BaseObject* object) {
+  if(field.polymorphic) {
+    const auto& any = field.property->get(object).cast<oatpp::Any>();
+    return any.retrieve(field.property->info.typeSelector->selectType(object));
+  }
+  return field.property->get(object);
 }
 
 void Serializer::serializeDateTime(Serializer* serializer,
@@ -112,8 +364,6 @@ void Serializer::serializeString(Serializer* serializer,
                                  const oatpp::Void& polymorph)
 {
 
-  (void) serializer;
-
   if(!key) {
     throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::serializeString()]: Error. The key can't be null.");
   }
@@ -124,7 +374,14 @@ void Serializer::serializeString(Serializer* serializer,
 
     auto str = static_cast<std::string*>(polymorph.get());
     bson::Utils::writeInt32(stream, str->size() + 1);
-    stream->writeSimple(str->data(), str->size());
+
+    bson::SliceList* slices;
+    if((v_buff_size) str->size() >= serializer->m_config->referenceThreshold && (slices = getSlices(stream)) != nullptr) {
+      slices->addReference(polymorph.getPtr(), str->data(), str->size());
+    } else {
+      stream->writeSimple(str->data(), str->size());
+    }
+
     stream->writeCharSimple(0);
 
   } else {
@@ -140,8 +397,6 @@ void Serializer::serializeInlineDocs(Serializer* serializer,
                                      const oatpp::Void& polymorph)
 {
 
-  (void) serializer;
-
   if(polymorph) {
 
     auto str = static_cast<std::string*>(polymorph.get());
@@ -157,7 +412,13 @@ void Serializer::serializeInlineDocs(Serializer* serializer,
     }
 
     bson::Utils::writeKey(stream, typeCode, key);
-    stream->writeSimple(str->data(), str->size());
+
+    bson::SliceList* slices;
+    if((v_buff_size) str->size() >= serializer->m_config->referenceThreshold && (slices = getSlices(stream)) != nullptr) {
+      slices->addReference(polymorph.getPtr(), str->data(), str->size());
+    } else {
+      stream->writeSimple(str->data(), str->size());
+    }
 
   } else if(key) {
     bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
@@ -205,6 +466,93 @@ void Serializer::serializeObjectId(Serializer* serializer,
   }
 }
 
+void Serializer::serializeBinary(Serializer* serializer,
+                                 data::stream::ConsistentOutputStream* stream,
+                                 const data::share::StringKeyLabel& key,
+                                 const oatpp::Void& polymorph)
+{
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::serializeBinary()]: Error. The key can't be null.");
+  }
+
+  if(polymorph) {
+
+    auto binary = static_cast<bson::type::Binary*>(polymorph.get());
+
+    bson::Utils::writeKey(stream, TypeCode::BINARY, key);
+    bson::Utils::writeInt32(stream, (v_int32) binary->getSize());
+    stream->writeCharSimple(binary->getSubtype());
+
+    bson::SliceList* slices;
+    if(binary->getSize() >= serializer->m_config->referenceThreshold && (slices = getSlices(stream)) != nullptr) {
+      slices->addReference(binary->getHandle(), binary->getData(), binary->getSize());
+    } else {
+      stream->writeSimple(binary->getData(), binary->getSize());
+    }
+
+  } else {
+    bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+  }
+
+}
+
+void Serializer::serializeDecimal128(Serializer* serializer,
+                                     data::stream::ConsistentOutputStream* stream,
+                                     const data::share::StringKeyLabel& key,
+                                     const oatpp::Void& polymorph)
+{
+  (void) serializer;
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::serializeDecimal128()]: Error. The key can't be null.");
+  }
+
+  if(polymorph) {
+
+    bson::Utils::writeKey(stream, TypeCode::DECIMAL_128, key);
+
+    auto decimal = static_cast<bson::type::Decimal128*>(polymorph.get());
+    bson::Utils::writeUInt64(stream, decimal->getLow());
+    bson::Utils::writeUInt64(stream, decimal->getHigh());
+
+  } else {
+    bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+  }
+}
+
+void Serializer::serializeSharedString(Serializer* serializer,
+                                       data::stream::ConsistentOutputStream* stream,
+                                       const data::share::StringKeyLabel& key,
+                                       const oatpp::Void& polymorph)
+{
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::serializeSharedString()]: Error. The key can't be null.");
+  }
+
+  if(polymorph) {
+
+    auto str = static_cast<bson::type::SharedString*>(polymorph.get());
+
+    bson::Utils::writeKey(stream, TypeCode::STRING, key);
+    bson::Utils::writeInt32(stream, (v_int32) str->getSize() + 1);
+
+    bson::SliceList* slices;
+    if(str->getSize() >= serializer->m_config->referenceThreshold && (slices = getSlices(stream)) != nullptr) {
+      slices->addReference(str->getHandle(), str->getData(), str->getSize());
+    } else {
+      stream->writeSimple(str->getData(), str->getSize());
+    }
+
+    stream->writeCharSimple(0);
+
+  } else {
+    bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
+  }
+
+}
+
 void Serializer::serializeAny(Serializer* serializer,
                               data::stream::ConsistentOutputStream* stream,
                               const data::share::StringKeyLabel& key,
@@ -259,24 +607,32 @@ void Serializer::serializeCollection(Serializer* serializer,
   if(polymorph) {
 
     bson::Utils::writeKey(stream, TypeCode::DOCUMENT_ARRAY, key);
-    data::stream::BufferOutputStream innerStream;
+    v_buff_size lengthPosition = beginDocument(stream);
 
     auto dispatcher = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(polymorph.getValueType()->polymorphicDispatcher);
+
+    const v_int32 parallelThreshold = serializer->getConfig()->parallelCollectionThreshold;
+    if(parallelThreshold > 0 && dispatcher->getCollectionSize(polymorph) >= parallelThreshold) {
+      serializeCollectionParallel(serializer, stream, dispatcher, polymorph);
+      endDocument(stream, lengthPosition);
+      return;
+    }
+
     v_int32 index = 0;
 
+    v_char8 indexKeyBuffer[bson::Utils::ARRAY_INDEX_KEY_BUFFER_SIZE];
+
     auto iterator = dispatcher->beginIteration(polymorph);
     while (!iterator->finished()) {
       const auto& value = iterator->get();
       if (value || serializer->getConfig()->includeNullFields) {
-        serializer->serialize(&innerStream, utils::conversion::int32ToStr(index), value);
+        serializer->serialize(stream, bson::Utils::getArrayIndexKey(index, indexKeyBuffer), value);
         index ++;
       }
       iterator->next();
     }
 
-    bson::Utils::writeInt32(stream, innerStream.getCurrentPosition() + 5);
-    stream->writeSimple(innerStream.getData(), innerStream.getCurrentPosition());
-    stream->writeCharSimple(0);
+    endDocument(stream, lengthPosition);
 
   } else if(key) {
     bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
@@ -286,6 +642,107 @@ void Serializer::serializeCollection(Serializer* serializer,
 
 }
 
+void Serializer::serializeCollectionRange(Serializer* serializer,
+                                          data::stream::ConsistentOutputStream* stream,
+                                          const std::vector<oatpp::Void>& values,
+                                          v_int32 begin,
+                                          v_int32 end)
+{
+  v_char8 indexKeyBuffer[bson::Utils::ARRAY_INDEX_KEY_BUFFER_SIZE];
+  for(v_int32 index = begin; index < end; index ++) {
+    serializer->serialize(stream, bson::Utils::getArrayIndexKey(index, indexKeyBuffer), values[index]);
+  }
+}
+
+void Serializer::serializeCollectionParallel(Serializer* serializer,
+                                             data::stream::ConsistentOutputStream* stream,
+                                             const data::mapping::type::__class::Collection::PolymorphicDispatcher* dispatcher,
+                                             const oatpp::Void& polymorph)
+{
+
+  /* Not worth a separate range for less elements */
+  static constexpr v_int32 MIN_ELEMENTS_PER_RANGE = 1024;
+
+  const auto& config = serializer->getConfig();
+
+  std::vector<oatpp::Void> values;
+  values.reserve((size_t) dispatcher->getCollectionSize(polymorph));
+  auto iterator = dispatcher->beginIteration(polymorph);
+  while (!iterator->finished()) {
+    const auto& value = iterator->get();
+    if (value || config->includeNullFields) {
+      values.push_back(value);
+    }
+    iterator->next();
+  }
+
+  const v_int32 count = (v_int32) values.size();
+
+  auto& pool = bson::WorkerPool::getDefault();
+
+  v_int32 rangesCount = config->parallelCollectionThreads;
+  if(rangesCount <= 0) {
+    rangesCount = pool.getThreadsCount() + 1;
+  }
+  if(rangesCount > count / MIN_ELEMENTS_PER_RANGE) {
+    rangesCount = count / MIN_ELEMENTS_PER_RANGE;
+  }
+
+  if(rangesCount < 2) {
+    serializeCollectionRange(serializer, stream, values, 0, count);
+    return;
+  }
+
+  /* The first range is run by the calling thread and is written directly to the stream */
+  auto slices = getSlices(stream);
+
+  if(slices) {
+
+    /* Serializing to SliceList - each range gets its own SliceList, so large values stay referenced in place */
+    std::vector<std::shared_ptr<bson::SliceList>> rangeSlices(rangesCount);
+
+    pool.run(rangesCount, [&](v_int32 index) {
+      v_int32 begin = (v_int32) ((v_int64) count * index / rangesCount);
+      v_int32 end = (v_int32) ((v_int64) count * (index + 1) / rangesCount);
+      if(index == 0) {
+        serializeCollectionRange(serializer, stream, values, begin, end);
+      } else {
+        InterpretationCache::Scope interpretationsScope(serializer->m_interpretations, config->enableInterpretations);
+        auto rangeList = std::make_shared<bson::SliceList>();
+        SlicesGuard guard(rangeList.get());
+        serializeCollectionRange(serializer, rangeList->getScratchStream(), values, begin, end);
+        rangeSlices[index] = rangeList;
+      }
+    });
+
+    for(v_int32 i = 1; i < rangesCount; i ++) {
+      slices->splice(rangeSlices[i]);
+    }
+
+    return;
+
+  }
+
+  std::vector<std::unique_ptr<data::stream::BufferOutputStream>> buffers(rangesCount);
+
+  pool.run(rangesCount, [&](v_int32 index) {
+    v_int32 begin = (v_int32) ((v_int64) count * index / rangesCount);
+    v_int32 end = (v_int32) ((v_int64) count * (index + 1) / rangesCount);
+    if(index == 0) {
+      serializeCollectionRange(serializer, stream, values, begin, end);
+    } else {
+      InterpretationCache::Scope interpretationsScope(serializer->m_interpretations, config->enableInterpretations);
+      buffers[index].reset(new data::stream::BufferOutputStream());
+      serializeCollectionRange(serializer, buffers[index].get(), values, begin, end);
+    }
+  });
+
+  for(v_int32 i = 1; i < rangesCount; i ++) {
+    stream->writeSimple(buffers[i]->getData(), buffers[i]->getCurrentPosition());
+  }
+
+}
+
 void Serializer::serializeMap(Serializer* serializer,
                               data::stream::ConsistentOutputStream* stream,
                               const data::share::StringKeyLabel& key,
@@ -294,7 +751,7 @@ void Serializer::serializeMap(Serializer* serializer,
   if(polymorph) {
 
     bson::Utils::writeKey(stream, TypeCode::DOCUMENT_EMBEDDED, key);
-    data::stream::BufferOutputStream innerStream;
+    v_buff_size lengthPosition = beginDocument(stream);
 
     auto dispatcher = static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(polymorph.getValueType()->polymorphicDispatcher);
 
@@ -303,14 +760,12 @@ void Serializer::serializeMap(Serializer* serializer,
       const auto& value = iterator->getValue();
       if(value || serializer->getConfig()->includeNullFields) {
         const auto& key = iterator->getKey().cast<oatpp::String>();
-        serializer->serialize(&innerStream, key, value);
+        serializer->serialize(stream, key, value);
       }
       iterator->next();
     }
 
-    bson::Utils::writeInt32(stream, innerStream.getCurrentPosition() + 5);
-    stream->writeSimple(innerStream.getData(), innerStream.getCurrentPosition());
-    stream->writeCharSimple(0);
+    endDocument(stream, lengthPosition);
 
   } else if(key) {
     bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
@@ -329,32 +784,26 @@ void Serializer::serializeObject(Serializer* serializer,
   if(polymorph) {
 
     bson::Utils::writeKey(stream, TypeCode::DOCUMENT_EMBEDDED, key);
+    v_buff_size lengthPosition = beginDocument(stream);
 
-    data::stream::BufferOutputStream innerStream;
-
-    auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(polymorph.getValueType()->polymorphicDispatcher);
-    auto fields = dispatcher->getProperties()->getList();
+    auto plan = serializer->getObjectPlan(polymorph.getValueType());
     auto object = static_cast<oatpp::BaseObject*>(polymorph.get());
+    bool includeNullFields = serializer->getConfig()->includeNullFields;
 
-    for (auto const &field : fields) {
-
-      oatpp::Void value;
-      if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
-        const auto& any = field->get(object).cast<oatpp::Any>();
-        value = any.retrieve(field->info.typeSelector->selectType(object));
-      } else {
-        value = field->get(object);
-      }
+    for (auto const &field : plan->fields) {
 
-      if (value || serializer->getConfig()->includeNullFields) {
-        serializer->serialize(&innerStream, field->name, value);
+      const auto& value = getFieldValue(field, object);
+      if (value || includeNullFields) {
+        if(field.method) {
+          (*field.method)(serializer, stream, field.key, value);
+        } else {
+          serializer->serialize(stream, field.key, value);
+        }
       }
 
     }
 
-    bson::Utils::writeInt32(stream, innerStream.getCurrentPosition() + 5);
-    stream->writeSimple(innerStream.getData(), innerStream.getCurrentPosition());
-    stream->writeCharSimple(0);
+    endDocument(stream, lengthPosition);
 
   } else if(key) {
     bson::Utils::writeKey(stream, TypeCode::NULL_VALUE, key);
@@ -374,7 +823,7 @@ void Serializer::serialize(data::stream::ConsistentOutputStream* stream,
     (*method)(this, stream, key, polymorph);
   } else {
 
-    auto* interpretation = polymorph.getValueType()->findInterpretation(m_config->enableInterpretations);
+    auto* interpretation = m_interpretations.find(polymorph.getValueType(), m_config->enableInterpretations);
     if(interpretation) {
       serialize(stream, key, interpretation->toInterpretation(polymorph));
     } else {
@@ -388,7 +837,281 @@ void Serializer::serialize(data::stream::ConsistentOutputStream* stream,
 void Serializer::serializeToStream(data::stream::ConsistentOutputStream* stream,
                                    const oatpp::Void& polymorph)
 {
-  serialize(stream, nullptr, polymorph);
+
+  InterpretationCache::Scope interpretationsScope(m_interpretations, m_config->enableInterpretations);
+
+  auto buffer = dynamic_cast<data::stream::BufferOutputStream*>(stream);
+
+  if(buffer) {
+    v_buff_size startPosition = buffer->getCurrentPosition();
+    try {
+      serialize(buffer, nullptr, polymorph);
+    } catch (...) {
+      buffer->setCurrentPosition(startPosition); // don't leave a partially written document in the caller's buffer.
+      throw;
+    }
+    return;
+  }
+
+  auto documentBuffer = bson::BufferArena::getThreadLocal().borrow();
+  serialize(documentBuffer.get(), nullptr, polymorph);
+  stream->writeSimple(documentBuffer->getData(), documentBuffer->getCurrentPosition());
+
+}
+
+void Serializer::serializeToSlices(bson::SliceList* slices, const oatpp::Void& polymorph) {
+
+  auto stream = slices->getScratchStream();
+  v_buff_size scratchPosition = stream->getCurrentPosition();
+  v_buff_size referencesCount = slices->getReferencesCount();
+
+  InterpretationCache::Scope interpretationsScope(m_interpretations, m_config->enableInterpretations);
+  SlicesGuard guard(slices);
+  try {
+    serialize(stream, nullptr, polymorph);
+  } catch (...) {
+    slices->rollback(scratchPosition, referencesCount);
+    throw;
+  }
+
+}
+
+v_buff_size Serializer::serializeToBuffer(void* buffer, v_buff_size capacity, const oatpp::Void& polymorph) {
+  InterpretationCache::Scope interpretationsScope(m_interpretations, m_config->enableInterpretations);
+  FixedBufferStream stream(buffer, capacity);
+  serialize(&stream, nullptr, polymorph);
+  return stream.getCurrentPosition();
+}
+
+v_buff_size Serializer::computeStringSize(Serializer* serializer,
+                                          const data::share::StringKeyLabel& key,
+                                          const oatpp::Void& polymorph)
+{
+  (void) serializer;
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeStringSize()]: Error. The key can't be null.");
+  }
+
+  if(polymorph) {
+    auto str = static_cast<std::string*>(polymorph.get());
+    return getKeySize(key) + 4 + str->size() + 1;
+  }
+  return getKeySize(key);
+}
+
+v_buff_size Serializer::computeInlineDocsSize(Serializer* serializer,
+                                              const data::share::StringKeyLabel& key,
+                                              const oatpp::Void& polymorph)
+{
+  (void) serializer;
+
+  if(polymorph) {
+    auto str = static_cast<std::string*>(polymorph.get());
+    if(str->size() < 5) {
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeInlineDocsSize()]: Error. Invalid inline object size.");
+    }
+    return getKeySize(key) + str->size();
+  } else if(key) {
+    return getKeySize(key);
+  }
+  throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeInlineDocsSize()]: Error. null object with null key.");
+}
+
+v_buff_size Serializer::computeSharedStringSize(Serializer* serializer,
+                                                const data::share::StringKeyLabel& key,
+                                                const oatpp::Void& polymorph)
+{
+  (void) serializer;
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeSharedStringSize()]: Error. The key can't be null.");
+  }
+
+  if(polymorph) {
+    auto str = static_cast<bson::type::SharedString*>(polymorph.get());
+    return getKeySize(key) + 4 + str->getSize() + 1;
+  }
+  return getKeySize(key);
+}
+
+v_buff_size Serializer::computeBinarySize(Serializer* serializer,
+                                          const data::share::StringKeyLabel& key,
+                                          const oatpp::Void& polymorph)
+{
+  (void) serializer;
+
+  if(!key) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeBinarySize()]: Error. The key can't be null.");
+  }
+
+  if(polymorph) {
+    auto binary = static_cast<bson::type::Binary*>(polymorph.get());
+    return getKeySize(key) + 4 + 1 + binary->getSize();
+  }
+  return getKeySize(key);
+}
+
+v_buff_size Serializer::computeAnySize(Serializer* serializer,
+                                       const data::share::StringKeyLabel& key,
+                                       const oatpp::Void& polymorph)
+{
+  if(polymorph) {
+    auto anyHandle = static_cast<data::mapping::type::AnyHandle*>(polymorph.get());
+    return serializer->computeElementSize(key, oatpp::Void(anyHandle->ptr, anyHandle->type));
+  } else if(key) {
+    return getKeySize(key);
+  }
+  throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeAnySize()]: Error. null object with null key.");
+}
+
+v_buff_size Serializer::computeEnumSize(Serializer* serializer,
+                                        const data::share::StringKeyLabel& key,
+                                        const oatpp::Void& polymorph)
+{
+
+  auto polymorphicDispatcher = static_cast<const data::mapping::type::__class::AbstractEnum::PolymorphicDispatcher*>(
+    polymorph.getValueType()->polymorphicDispatcher
+  );
+
+  data::mapping::type::EnumInterpreterError e = data::mapping::type::EnumInterpreterError::OK;
+  const auto& interpretation = polymorphicDispatcher->toInterpretation(polymorph, e);
+
+  switch(e) {
+    case data::mapping::type::EnumInterpreterError::OK:
+      return serializer->computeElementSize(key, interpretation);
+    case data::mapping::type::EnumInterpreterError::CONSTRAINT_NOT_NULL:
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeEnumSize()]: Error. Enum constraint violated - 'NotNull'.");
+    default:
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeEnumSize()]: Error. Can't serialize Enum.");
+  }
+
+}
+
+v_buff_size Serializer::computeCollectionSize(Serializer* serializer,
+                                              const data::share::StringKeyLabel& key,
+                                              const oatpp::Void& polymorph)
+{
+
+  if(polymorph) {
+
+    v_buff_size result = getKeySize(key) + 5;
+
+    auto dispatcher = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(polymorph.getValueType()->polymorphicDispatcher);
+
+    v_int32 index = 0;
+
+    v_char8 indexKeyBuffer[bson::Utils::ARRAY_INDEX_KEY_BUFFER_SIZE];
+
+    auto iterator = dispatcher->beginIteration(polymorph);
+    while (!iterator->finished()) {
+      const auto& value = iterator->get();
+      if (value || serializer->getConfig()->includeNullFields) {
+        result += serializer->computeElementSize(bson::Utils::getArrayIndexKey(index, indexKeyBuffer), value);
+        index ++;
+      }
+      iterator->next();
+    }
+
+    return result;
+
+  } else if(key) {
+    return getKeySize(key);
+  }
+  throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeCollectionSize()]: Error. null object with null key.");
+
+}
+
+v_buff_size Serializer::computeMapSize(Serializer* serializer,
+                                       const data::share::StringKeyLabel& key,
+                                       const oatpp::Void& polymorph)
+{
+
+  if(polymorph) {
+
+    v_buff_size result = getKeySize(key) + 5;
+
+    auto dispatcher = static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(polymorph.getValueType()->polymorphicDispatcher);
+
+    auto iterator = dispatcher->beginIteration(polymorph);
+    while (!iterator->finished()) {
+      const auto& value = iterator->getValue();
+      if(value || serializer->getConfig()->includeNullFields) {
+        const auto& key = iterator->getKey().cast<oatpp::String>();
+        result += serializer->computeElementSize(key, value);
+      }
+      iterator->next();
+    }
+
+    return result;
+
+  } else if(key) {
+    return getKeySize(key);
+  }
+  throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeMapSize()]: Error. null object with null key.");
+
+}
+
+v_buff_size Serializer::computeObjectSize(Serializer* serializer,
+                                          const data::share::StringKeyLabel& key,
+                                          const oatpp::Void& polymorph)
+{
+
+  if(polymorph) {
+
+    v_buff_size result = getKeySize(key) + 5;
+
+    auto plan = serializer->getObjectPlan(polymorph.getValueType());
+    auto object = static_cast<oatpp::BaseObject*>(polymorph.get());
+    bool includeNullFields = serializer->getConfig()->includeNullFields;
+
+    for (auto const &field : plan->fields) {
+      const auto& value = getFieldValue(field, object);
+      if (value || includeNullFields) {
+        if(field.sizeMethod) {
+          result += (*field.sizeMethod)(serializer, field.key, value);
+        } else {
+          result += serializer->computeElementSize(field.key, value);
+        }
+      }
+    }
+
+    return result;
+
+  } else if(key) {
+    return getKeySize(key);
+  }
+  throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeObjectSize()]: Error. null object with null key.");
+
+}
+
+v_buff_size Serializer::computeElementSize(const data::share::StringKeyLabel& key, const oatpp::Void& polymorph) {
+
+  auto id = polymorph.getValueType()->classId.id;
+
+  if(id < m_sizeMethods.size() && m_sizeMethods[id]) {
+    return (*m_sizeMethods[id])(this, key, polymorph);
+  }
+
+  if(id < m_methods.size() && m_methods[id]) {
+    auto buffer = bson::BufferArena::getThreadLocal().borrow();
+    (*m_methods[id])(this, buffer.get(), key, polymorph);
+    return buffer->getCurrentPosition();
+  }
+
+  auto* interpretation = m_interpretations.find(polymorph.getValueType(), m_config->enableInterpretations);
+  if(interpretation) {
+    return computeElementSize(key, interpretation->toInterpretation(polymorph));
+  }
+
+  throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computeElementSize()]: "
+                           "Error. No serialize method for type '" + std::string(polymorph.getValueType()->classId.name) + "'");
+
+}
+
+v_buff_size Serializer::computeSize(const oatpp::Void& polymorph) {
+  InterpretationCache::Scope interpretationsScope(m_interpretations, m_config->enableInterpretations);
+  return computeElementSize(nullptr, polymorph);
 }
 
 const std::shared_ptr<Serializer::Config>& Serializer::getConfig() {
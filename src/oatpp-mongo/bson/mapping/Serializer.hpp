@@ -26,6 +26,10 @@
 #ifndef oatpp_mongo_bson_mapping_Serializer_hpp
 #define oatpp_mongo_bson_mapping_Serializer_hpp
 
+#include "InterpretationCache.hpp"
+#include "PlanCache.hpp"
+
+#include "oatpp-mongo/bson/SliceList.hpp"
 #include "oatpp-mongo/bson/Utils.hpp"
 #include "oatpp-mongo/bson/Types.hpp"
 
@@ -79,16 +83,81 @@ public:
     bool throwOnUnknownTypes = true;
 
     /**
-     * Enable type interpretations.
+     * Enable type interpretations. <br>
+     * Interpretations are resolved once per type for each distinct list and cached.
+     * The list is compared with the cached lists once per top-level call - see &id:oatpp::mongo::bson::mapping::InterpretationCache;.
      */
     std::vector<std::string> enableInterpretations = {};
 
+    /**
+     * When serializing to &id:oatpp::mongo::bson::SliceList; - strings and inline documents of this size (in bytes)
+     * or larger are referenced in place instead of being copied. See &l:Serializer::serializeToSlices ();.
+     */
+    v_buff_size referenceThreshold = bson::SliceList::DEFAULT_REFERENCE_THRESHOLD;
+
+    /**
+     * Collections with this count of elements or more are split into index ranges serialized concurrently
+     * on &id:oatpp::mongo::bson::WorkerPool::getDefault;. `0` - disabled. <br>
+     * When serializing to &id:oatpp::mongo::bson::SliceList; each range is serialized to its own SliceList
+     * spliced in order - large values of all ranges stay referenced in place.
+     */
+    v_int32 parallelCollectionThreshold = 0;
+
+    /**
+     * Max count of ranges of a large collection serialized concurrently - see &l:Serializer::Config::parallelCollectionThreshold;.
+     * `0` - count of pool workers plus the calling thread.
+     */
+    v_int32 parallelCollectionThreads = 0;
+
   };
 public:
   typedef void (*SerializerMethod)(Serializer*,
                                    data::stream::ConsistentOutputStream*,
                                    const data::share::StringKeyLabel& key,
                                    const oatpp::Void&);
+private:
+
+  typedef v_buff_size (*SizeMethod)(Serializer*,
+                                    const data::share::StringKeyLabel& key,
+                                    const oatpp::Void&);
+
+  /*
+   * Field of the DTO class resolved for serialization.
+   */
+  struct FieldPlan {
+    Property* property;
+    data::share::StringKeyLabel key;
+    SerializerMethod method;
+    SizeMethod sizeMethod;
+    bool polymorphic;
+  };
+
+  /*
+   * Serialization plan of the DTO class. Built on first use and cached per Type.
+   * Cached plans are dropped by `setSerializerMethod()` since they hold resolved methods.
+   */
+  struct ObjectPlan {
+    std::vector<FieldPlan> fields;
+  };
+
+private:
+
+  /*
+   * Reserve space for the document length and return its position in the stream.
+   * Documents are always written to a single `data::stream::BufferOutputStream` - see `serializeToStream()`,
+   * or to the caller-owned memory region - see `serializeToBuffer()`. Throws on any other stream.
+   * When serializing to SliceList, the placeholder holds the size of data referenced so far,
+   * so that `endDocument()` can account for the referenced data.
+   */
+  static v_buff_size beginDocument(data::stream::ConsistentOutputStream* stream);
+
+  /*
+   * Write the document terminator and patch the document length reserved by `beginDocument()`.
+   */
+  static void endDocument(data::stream::ConsistentOutputStream* stream, v_buff_size lengthPosition);
+
+  static oatpp::Void getFieldValue(const FieldPlan& field, oatpp::BaseObject* object);
+
 private:
 
   template<class T>
@@ -141,6 +210,21 @@ private:
                                 const data::share::StringKeyLabel& key,
                                 const oatpp::Void& polymorph);
 
+  static void serializeBinary(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const data::share::StringKeyLabel& key,
+                              const oatpp::Void& polymorph);
+
+  static void serializeDecimal128(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const data::share::StringKeyLabel& key,
+                                  const oatpp::Void& polymorph);
+
+  static void serializeSharedString(Serializer* serializer,
+                                    data::stream::ConsistentOutputStream* stream,
+                                    const data::share::StringKeyLabel& key,
+                                    const oatpp::Void& polymorph);
+
   static void serializeAny(Serializer* serializer,
                            data::stream::ConsistentOutputStream* stream,
                            const data::share::StringKeyLabel& key,
@@ -156,6 +240,17 @@ private:
                                   const data::share::StringKeyLabel& key,
                                   const oatpp::Void& polymorph);
 
+  static void serializeCollectionRange(Serializer* serializer,
+                                       data::stream::ConsistentOutputStream* stream,
+                                       const std::vector<oatpp::Void>& values,
+                                       v_int32 begin,
+                                       v_int32 end);
+
+  static void serializeCollectionParallel(Serializer* serializer,
+                                          data::stream::ConsistentOutputStream* stream,
+                                          const data::mapping::type::__class::Collection::PolymorphicDispatcher* dispatcher,
+                                          const oatpp::Void& polymorph);
+
   static void serializeMap(Serializer* serializer,
                            data::stream::ConsistentOutputStream* stream,
                            const data::share::StringKeyLabel& key,
@@ -170,9 +265,79 @@ private:
                  const data::share::StringKeyLabel& key,
                  const oatpp::Void& polymorph);
 
+private:
+
+  static v_buff_size getKeySize(const data::share::StringKeyLabel& key) {
+    return key ? key.getSize() + 2 : 0;
+  }
+
+  template<v_buff_size VALUE_SIZE>
+  static v_buff_size computePrimitiveSize(Serializer* serializer,
+                                          const data::share::StringKeyLabel& key,
+                                          const oatpp::Void& polymorph)
+  {
+    (void) serializer;
+
+    if(!key) {
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::Serializer::computePrimitiveSize()]: Error. The key can't be null.");
+    }
+
+    if(polymorph) {
+      return getKeySize(key) + VALUE_SIZE;
+    }
+    return getKeySize(key);
+  }
+
+  static v_buff_size computeStringSize(Serializer* serializer,
+                                       const data::share::StringKeyLabel& key,
+                                       const oatpp::Void& polymorph);
+
+  static v_buff_size computeInlineDocsSize(Serializer* serializer,
+                                           const data::share::StringKeyLabel& key,
+                                           const oatpp::Void& polymorph);
+
+  static v_buff_size computeSharedStringSize(Serializer* serializer,
+                                             const data::share::StringKeyLabel& key,
+                                             const oatpp::Void& polymorph);
+
+  static v_buff_size computeBinarySize(Serializer* serializer,
+                                       const data::share::StringKeyLabel& key,
+                                       const oatpp::Void& polymorph);
+
+  static v_buff_size computeAnySize(Serializer* serializer,
+                                    const data::share::StringKeyLabel& key,
+                                    const oatpp::Void& polymorph);
+
+  static v_buff_size computeEnumSize(Serializer* serializer,
+                                     const data::share::StringKeyLabel& key,
+                                     const oatpp::Void& polymorph);
+
+  static v_buff_size computeCollectionSize(Serializer* serializer,
+                                           const data::share::StringKeyLabel& key,
+                                           const oatpp::Void& polymorph);
+
+  static v_buff_size computeMapSize(Serializer* serializer,
+                                    const data::share::StringKeyLabel& key,
+                                    const oatpp::Void& polymorph);
+
+  static v_buff_size computeObjectSize(Serializer* serializer,
+                                       const data::share::StringKeyLabel& key,
+                                       const oatpp::Void& polymorph);
+
+  v_buff_size computeElementSize(const data::share::StringKeyLabel& key, const oatpp::Void& polymorph);
+
+  void setSizeMethod(const data::mapping::type::ClassId& classId, SizeMethod method);
+
+  const ObjectPlan* getObjectPlan(const Type* type);
+  std::unique_ptr<ObjectPlan> buildObjectPlan(const Type* type);
+
 private:
   std::shared_ptr<Config> m_config;
   std::vector<SerializerMethod> m_methods;
+  std::vector<SizeMethod> m_sizeMethods;
+private:
+  PlanCache<ObjectPlan> m_objectPlans;
+  InterpretationCache m_interpretations;
 public:
 
   /**
@@ -189,12 +354,46 @@ public:
   void setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method);
 
   /**
-   * Serialize object to stream.
+   * Serialize object to stream. <br>
+   * The whole document is written in a single pass - lengths of nested documents are reserved upfront and patched
+   * once the nested document is closed. If the `stream` is a &id:oatpp::data::stream::BufferOutputStream; the document
+   * is written directly to it, otherwise it's written to a temporary buffer first and then to the `stream` in one call.
    * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
    * @param polymorph - DTO as &id:oatpp::Void;.
    */
   void serializeToStream(data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph);
 
+  /**
+   * Compute the exact size of BSON produced by &l:Serializer::serializeToStream (); without serializing it. <br>
+   * Types with custom serializer methods (see &l:Serializer::setSerializerMethod ();) are measured by serializing
+   * them to a temporary buffer.
+   * @param polymorph - DTO as &id:oatpp::Void;.
+   * @return - size of BSON document in bytes.
+   */
+  v_buff_size computeSize(const oatpp::Void& polymorph);
+
+  /**
+   * Serialize object and append it to &id:oatpp::mongo::bson::SliceList;. <br>
+   * Strings and inline documents larger than &l:Serializer::Config::referenceThreshold; are not copied,
+   * but referenced in place. Such values must not be modified while the SliceList is in use.
+   * @param slices - &id:oatpp::mongo::bson::SliceList;.
+   * @param polymorph - DTO as &id:oatpp::Void;.
+   */
+  void serializeToSlices(bson::SliceList* slices, const oatpp::Void& polymorph);
+
+  /**
+   * Serialize object to the caller-owned memory region. <br>
+   * The document is written directly to `buffer` - no intermediate buffer is used. Writing stops at `capacity`,
+   * but serialization goes on to count the size of the document. <br>
+   * Same as `snprintf` - if the returned size is greater than `capacity` the content of `buffer` is unspecified
+   * and the call should be repeated with a buffer of at least the returned size.
+   * @param buffer - pointer to memory region.
+   * @param capacity - size of memory region.
+   * @param polymorph - DTO as &id:oatpp::Void;.
+   * @return - size of BSON document in bytes.
+   */
+  v_buff_size serializeToBuffer(void* buffer, v_buff_size capacity, const oatpp::Void& polymorph);
+
   /**
    * Get serializer config.
    * @return
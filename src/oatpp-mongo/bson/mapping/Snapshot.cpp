@@ -0,0 +1,242 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Snapshot.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+namespace {
+
+  struct Element {
+    const char* key;
+    v_buff_size keySize;
+    v_char8 typeCode;
+    const char* value;
+    v_buff_size valueSize;
+  };
+
+  struct Change {
+    std::string path;
+    v_char8 typeCode;
+    const char* value;
+    v_buff_size valueSize;
+  };
+
+  void readElements(const char* data, v_buff_size size, std::vector<Element>& elements) {
+
+    parser::Caret caret(data, size);
+
+    if(size < 5 || Utils::readInt32(caret) != size || data[size - 1] != 0) {
+      throw std::runtime_error("[oatpp::mongo::bson::mapping::Snapshot::diff()]: Error. Invalid document.");
+    }
+
+    while(caret.getPosition() < size - 1) {
+
+      Element element;
+      element.typeCode = (v_char8) *caret.getCurrData();
+      caret.inc();
+
+      element.key = caret.getCurrData();
+      element.keySize = Utils::findCStringSize(caret);
+      if(element.keySize < 0) {
+        throw std::runtime_error("[oatpp::mongo::bson::mapping::Snapshot::diff()]: Error. Invalid element key.");
+      }
+      caret.inc(element.keySize + 1);
+
+      element.value = caret.getCurrData();
+      Deserializer::skipElement(caret, element.typeCode);
+      if(caret.hasError() || caret.getPosition() > size - 1) {
+        throw std::runtime_error("[oatpp::mongo::bson::mapping::Snapshot::diff()]: Error. Invalid element value.");
+      }
+      element.valueSize = caret.getCurrData() - element.value;
+
+      elements.push_back(element);
+
+    }
+
+  }
+
+  bool isPathSafe(const std::vector<Element>& elements) {
+    for(auto& element : elements) {
+      if(element.keySize == 0 || element.key[0] == '$' || std::memchr(element.key, '.', element.keySize) != nullptr) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const Element* findElement(const std::vector<Element>& elements, v_buff_size hint, const Element& element) {
+
+    /* Both documents are usually serialized from the same DTO class - check the same position first. */
+    if(hint < (v_buff_size) elements.size()) {
+      auto& candidate = elements[hint];
+      if(candidate.keySize == element.keySize && std::memcmp(candidate.key, element.key, element.keySize) == 0) {
+        return &candidate;
+      }
+    }
+
+    for(auto& candidate : elements) {
+      if(candidate.keySize == element.keySize && std::memcmp(candidate.key, element.key, element.keySize) == 0) {
+        return &candidate;
+      }
+    }
+
+    return nullptr;
+
+  }
+
+  void diffElements(const std::vector<Element>& before,
+                    const std::vector<Element>& after,
+                    const std::string& prefix,
+                    std::vector<Change>& sets,
+                    std::vector<std::string>& unsets)
+  {
+
+    for(v_buff_size i = 0; i < (v_buff_size) after.size(); i ++) {
+
+      auto& element = after[i];
+      auto previous = findElement(before, i, element);
+      std::string path = prefix + std::string(element.key, element.keySize);
+
+      if(previous && previous->typeCode == element.typeCode && previous->valueSize == element.valueSize &&
+         std::memcmp(previous->value, element.value, element.valueSize) == 0)
+      {
+        continue;
+      }
+
+      if(previous && previous->typeCode == TypeCode::DOCUMENT_EMBEDDED && element.typeCode == TypeCode::DOCUMENT_EMBEDDED) {
+
+        std::vector<Element> nestedBefore;
+        std::vector<Element> nestedAfter;
+        readElements(previous->value, previous->valueSize, nestedBefore);
+        readElements(element.value, element.valueSize, nestedAfter);
+
+        if(isPathSafe(nestedBefore) && isPathSafe(nestedAfter)) {
+          diffElements(nestedBefore, nestedAfter, path + ".", sets, unsets);
+          continue;
+        }
+
+      }
+
+      sets.push_back({path, element.typeCode, element.value, element.valueSize});
+
+    }
+
+    for(v_buff_size i = 0; i < (v_buff_size) before.size(); i ++) {
+      auto& element = before[i];
+      if(findElement(after, i, element) == nullptr) {
+        unsets.push_back(prefix + std::string(element.key, element.keySize));
+      }
+    }
+
+  }
+
+  v_buff_size beginDocument(data::stream::BufferOutputStream* stream) {
+    v_buff_size position = stream->getCurrentPosition();
+    Utils::writeInt32(stream, 0);
+    return position;
+  }
+
+  void endDocument(data::stream::BufferOutputStream* stream, v_buff_size position) {
+    stream->writeCharSimple(0);
+    Utils::writeInt32((p_char8) stream->getData() + position, (v_int32) (stream->getCurrentPosition() - position));
+  }
+
+}
+
+Snapshot::Snapshot(const oatpp::String& document)
+  : m_document(document)
+{}
+
+Snapshot Snapshot::capture(const ObjectMapper* objectMapper, const oatpp::Void& object) {
+  return Snapshot(objectMapper->writeToStringPooled(object));
+}
+
+InlineDocument Snapshot::diff(const oatpp::String& before, const oatpp::String& after) {
+
+  if(!before || !after) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Snapshot::diff()]: Error. Document is null.");
+  }
+
+  std::vector<Element> beforeElements;
+  std::vector<Element> afterElements;
+  readElements(before->data(), (v_buff_size) before->size(), beforeElements);
+  readElements(after->data(), (v_buff_size) after->size(), afterElements);
+
+  if(!isPathSafe(beforeElements) || !isPathSafe(afterElements)) {
+    throw std::runtime_error("[oatpp::mongo::bson::mapping::Snapshot::diff()]: Error. Field name can't be used in update path.");
+  }
+
+  std::vector<Change> sets;
+  std::vector<std::string> unsets;
+  diffElements(beforeElements, afterElements, "", sets, unsets);
+
+  if(sets.empty() && unsets.empty()) {
+    return nullptr;
+  }
+
+  data::stream::BufferOutputStream stream;
+  auto rootPosition = beginDocument(&stream);
+
+  if(!sets.empty()) {
+    Utils::writeKey(&stream, TypeCode::DOCUMENT_EMBEDDED, "$set");
+    auto position = beginDocument(&stream);
+    for(auto& change : sets) {
+      Utils::writeKey(&stream, (TypeCode) change.typeCode, data::share::StringKeyLabel(nullptr, change.path.data(), change.path.size()));
+      stream.writeSimple(change.value, change.valueSize);
+    }
+    endDocument(&stream, position);
+  }
+
+  if(!unsets.empty()) {
+    Utils::writeKey(&stream, TypeCode::DOCUMENT_EMBEDDED, "$unset");
+    auto position = beginDocument(&stream);
+    for(auto& path : unsets) {
+      Utils::writeKey(&stream, TypeCode::STRING, data::share::StringKeyLabel(nullptr, path.data(), path.size()));
+      Utils::writeInt32(&stream, 1);
+      stream.writeCharSimple(0);
+    }
+    endDocument(&stream, position);
+  }
+
+  endDocument(&stream, rootPosition);
+
+  return InlineDocument(stream.toString().getPtr());
+
+}
+
+InlineDocument Snapshot::diff(const ObjectMapper* objectMapper, const oatpp::Void& object) const {
+  return diff(m_document, objectMapper->writeToStringPooled(object));
+}
+
+const oatpp::String& Snapshot::getDocument() const {
+  return m_document;
+}
+
+}}}}
@@ -0,0 +1,103 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_mapping_Snapshot_hpp
+#define oatpp_mongo_bson_mapping_Snapshot_hpp
+
+#include "./ObjectMapper.hpp"
+
+#include "oatpp-mongo/bson/Types.hpp"
+
+namespace oatpp { namespace mongo { namespace bson { namespace mapping {
+
+/**
+ * Snapshot of the DTO state. Used to produce minimal update documents - `{"$set": {...}, "$unset": {...}}`
+ * containing only the fields changed since the snapshot was taken. <br>
+ * Nested documents are compared field by field and changes are addressed by dotted paths (`"address.city"`).
+ * Arrays and other values are compared as a whole. <br>
+ * Usage:
+ * ```cpp
+ * auto user = mapper.readFromString<oatpp::Object<User>>(bson);
+ * auto snapshot = Snapshot::capture(&mapper, user);
+ *
+ * user->email = "new@example.com";
+ *
+ * auto statement = UpdateStatement::createShared(); // DTO with fields `q` and `u` (`u` is bson::InlineDocument)
+ * statement->q = filter;
+ * statement->u = snapshot.diff(&mapper, user); // {"$set": {"email": "new@example.com"}}
+ * if(statement->u) {
+ *   update.addDocument(statement, &mapper);
+ * }
+ * ```
+ */
+class Snapshot {
+private:
+  oatpp::String m_document;
+public:
+
+  /**
+   * Constructor.
+   * @param document - BSON document representing the DTO state.
+   */
+  Snapshot(const oatpp::String& document);
+
+  /**
+   * Take snapshot of the object. <br>
+   * The object is serialized with the same `objectMapper` which is later used for &l:Snapshot::diff ();
+   * so that unchanged values produce the same bytes.
+   * @param objectMapper - &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   * @param object - object to take snapshot of.
+   * @return - &l:Snapshot;.
+   */
+  static Snapshot capture(const ObjectMapper* objectMapper, const oatpp::Void& object);
+
+  /**
+   * Compute update document for two BSON documents.
+   * @param before - document before changes.
+   * @param after - document after changes.
+   * @return - update document as &id:oatpp::mongo::bson::InlineDocument; or `nullptr` if documents are equal.
+   * @throws - `std::runtime_error` if any of documents is invalid or top-level field name can't be used in update path.
+   */
+  static InlineDocument diff(const oatpp::String& before, const oatpp::String& after);
+
+  /**
+   * Compute update document for the current state of the object.
+   * @param objectMapper - &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   * @param object - object to compare with snapshot.
+   * @return - update document as &id:oatpp::mongo::bson::InlineDocument; or `nullptr` if nothing has changed.
+   */
+  InlineDocument diff(const ObjectMapper* objectMapper, const oatpp::Void& object) const;
+
+  /**
+   * Get BSON document of the snapshot.
+   * @return
+   */
+  const oatpp::String& getDocument() const;
+
+};
+
+}}}}
+
+#endif /* oatpp_mongo_bson_mapping_Snapshot_hpp */
@@ -0,0 +1,82 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Binary.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson { namespace type {
+
+Binary::Binary()
+  : m_subtype(SUBTYPE_GENERIC)
+  , m_handle(nullptr)
+  , m_data(nullptr)
+  , m_size(0)
+{}
+
+Binary::Binary(const oatpp::String& buffer, v_uint8 subtype)
+  : m_subtype(subtype)
+  , m_handle(buffer.getPtr())
+  , m_data(buffer ? buffer->data() : nullptr)
+  , m_size(buffer ? buffer->size() : 0)
+{}
+
+Binary::Binary(const std::shared_ptr<void>& handle, const void* data, v_buff_size size, v_uint8 subtype)
+  : m_subtype(subtype)
+  , m_handle(handle)
+  , m_data(data)
+  , m_size(size)
+{}
+
+v_uint8 Binary::getSubtype() const {
+  return m_subtype;
+}
+
+const std::shared_ptr<void>& Binary::getHandle() const {
+  return m_handle;
+}
+
+const void* Binary::getData() const {
+  return m_data;
+}
+
+v_buff_size Binary::getSize() const {
+  return m_size;
+}
+
+oatpp::String Binary::toString() const {
+  return oatpp::String((const char*) m_data, m_size);
+}
+
+bool Binary::operator==(const Binary &other) const {
+  return m_subtype == other.m_subtype && m_size == other.m_size &&
+         (m_size == 0 || m_data == other.m_data || std::memcmp(m_data, other.m_data, m_size) == 0);
+}
+
+bool Binary::operator!=(const Binary &other) const {
+  return !operator==(other);
+}
+
+}}}}
@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_type_Binary_hpp
+#define oatpp_mongo_bson_type_Binary_hpp
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace mongo { namespace bson { namespace type {
+
+/**
+ * BSON Binary data. <br>
+ * Holds subtype and a reference to the shared byte buffer - copying Binary doesn't copy the data.
+ */
+class Binary {
+public:
+
+  /**
+   * Generic binary subtype.
+   */
+  static constexpr v_uint8 SUBTYPE_GENERIC = 0x00;
+
+  /**
+   * Function binary subtype.
+   */
+  static constexpr v_uint8 SUBTYPE_FUNCTION = 0x01;
+
+  /**
+   * UUID binary subtype.
+   */
+  static constexpr v_uint8 SUBTYPE_UUID = 0x04;
+
+  /**
+   * MD5 binary subtype.
+   */
+  static constexpr v_uint8 SUBTYPE_MD5 = 0x05;
+
+  /**
+   * Encrypted BSON value binary subtype.
+   */
+  static constexpr v_uint8 SUBTYPE_ENCRYPTED = 0x06;
+
+  /**
+   * User defined binary subtype.
+   */
+  static constexpr v_uint8 SUBTYPE_USER_DEFINED = 0x80;
+
+private:
+  v_uint8 m_subtype;
+  std::shared_ptr<void> m_handle;
+  const void* m_data;
+  v_buff_size m_size;
+public:
+
+  /**
+   * Constructor. Empty binary.
+   */
+  Binary();
+
+  /**
+   * Constructor. Binary over the whole buffer.
+   * @param buffer - &id:oatpp::String;. The buffer is referenced, not copied.
+   * @param subtype - binary subtype.
+   */
+  Binary(const oatpp::String& buffer, v_uint8 subtype = SUBTYPE_GENERIC);
+
+  /**
+   * Constructor. Binary over the memory region kept alive by `handle`.
+   * @param handle - memory handle.
+   * @param data - pointer to data.
+   * @param size - size of data.
+   * @param subtype - binary subtype.
+   */
+  Binary(const std::shared_ptr<void>& handle, const void* data, v_buff_size size, v_uint8 subtype = SUBTYPE_GENERIC);
+
+  /**
+   * Get binary subtype.
+   * @return
+   */
+  v_uint8 getSubtype() const;
+
+  /**
+   * Get memory handle keeping the data alive.
+   * @return
+   */
+  const std::shared_ptr<void>& getHandle() const;
+
+  /**
+   * Get pointer to data.
+   * @return
+   */
+  const void* getData() const;
+
+  /**
+   * Get size of data.
+   * @return
+   */
+  v_buff_size getSize() const;
+
+  /**
+   * Copy data to string.
+   * @return
+   */
+  oatpp::String toString() const;
+
+  bool operator==(const Binary &other) const;
+  bool operator!=(const Binary &other) const;
+
+};
+
+}}}}
+
+#endif // oatpp_mongo_bson_type_Binary_hpp
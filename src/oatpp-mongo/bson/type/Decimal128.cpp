@@ -0,0 +1,546 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Decimal128.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace oatpp { namespace mongo { namespace bson { namespace type {
+
+namespace {
+
+  constexpr v_uint64 SIGN_BIT = 0x8000000000000000ULL;
+  constexpr v_uint64 NAN_HIGH = 0x7C00000000000000ULL;
+  constexpr v_uint64 INFINITY_HIGH = 0x7800000000000000ULL;
+  constexpr v_uint64 COEFFICIENT_HIGH_MASK = 0x0001FFFFFFFFFFFFULL;
+
+  constexpr v_uint32 COMBINATION_NAN = 0x1F;
+  constexpr v_uint32 COMBINATION_INFINITY = 0x1E;
+
+  /* 10^33 - max coefficient which can be multiplied by 10 */
+  constexpr v_uint64 POW10_33_HIGH = 0x0000314DC6448D93ULL;
+  constexpr v_uint64 POW10_33_LOW  = 0x38C15B0A00000000ULL;
+
+  /* 10^34 - first coefficient which doesn't fit 34 digits */
+  constexpr v_uint64 POW10_34_HIGH = 0x0001ED09BEAD87C0ULL;
+  constexpr v_uint64 POW10_34_LOW  = 0x378D8E6400000000ULL;
+
+  bool lessThan(v_uint64 high, v_uint64 low, v_uint64 otherHigh, v_uint64 otherLow) {
+    return high < otherHigh || (high == otherHigh && low < otherLow);
+  }
+
+  void multiplyAdd10(v_uint64& high, v_uint64& low, v_uint32 digit) {
+    v_uint64 p0 = (low & 0xFFFFFFFF) * 10 + digit;
+    v_uint64 p1 = (low >> 32) * 10 + (p0 >> 32);
+    low = (p1 << 32) | (p0 & 0xFFFFFFFF);
+    high = high * 10 + (p1 >> 32);
+  }
+
+  v_uint32 divide(v_uint64& high, v_uint64& low, v_uint32 divisor) {
+    v_uint32 parts[4] = {(v_uint32) (high >> 32), (v_uint32) high, (v_uint32) (low >> 32), (v_uint32) low};
+    v_uint64 remainder = 0;
+    for(v_int32 i = 0; i < 4; i ++) {
+      v_uint64 current = (remainder << 32) | parts[i];
+      parts[i] = (v_uint32) (current / divisor);
+      remainder = current % divisor;
+    }
+    high = ((v_uint64) parts[0] << 32) | parts[1];
+    low = ((v_uint64) parts[2] << 32) | parts[3];
+    return (v_uint32) remainder;
+  }
+
+  /* Writes coefficient digits (no leading zeros) to buffer of at least 36 bytes. Returns digits count. */
+  v_int32 writeDigits(v_uint64 high, v_uint64 low, char* buffer) {
+
+    char tmp[20];
+    v_int32 count = 0;
+
+    if(high == 0) {
+      do {
+        tmp[count ++] = (char) ('0' + low % 10);
+        low /= 10;
+      } while(low != 0);
+      for(v_int32 i = 0; i < count; i ++) {
+        buffer[i] = tmp[count - 1 - i];
+      }
+      return count;
+    }
+
+    v_uint32 chunks[4];
+    v_int32 chunksCount = 0;
+    while(high != 0 || low != 0) {
+      chunks[chunksCount ++] = divide(high, low, 1000000000);
+    }
+
+    v_uint32 top = chunks[chunksCount - 1];
+    while(top != 0) {
+      tmp[count ++] = (char) ('0' + top % 10);
+      top /= 10;
+    }
+
+    char* p = buffer;
+    while(count > 0) {
+      *p ++ = tmp[-- count];
+    }
+
+    for(v_int32 i = chunksCount - 2; i >= 0; i --) {
+      v_uint32 chunk = chunks[i];
+      for(v_int32 j = 8; j >= 0; j --) {
+        p[j] = (char) ('0' + chunk % 10);
+        chunk /= 10;
+      }
+      p += 9;
+    }
+
+    return (v_int32) (p - buffer);
+
+  }
+
+  void decode(v_uint64 high, v_uint64 low, v_int32& exponent, v_uint64& coefHigh, v_uint64& coefLow) {
+
+    if(((high >> 61) & 0x3) == 0x3) {
+      /* Coefficient in this form is always above 10^34 - 1. Non-canonical - treated as zero. */
+      exponent = (v_int32) ((high >> 47) & 0x3FFF) - Decimal128::EXPONENT_BIAS;
+      coefHigh = 0;
+      coefLow = 0;
+      return;
+    }
+
+    exponent = (v_int32) ((high >> 49) & 0x3FFF) - Decimal128::EXPONENT_BIAS;
+    coefHigh = high & COEFFICIENT_HIGH_MASK;
+    coefLow = low;
+
+    if(!lessThan(coefHigh, coefLow, POW10_34_HIGH, POW10_34_LOW)) {
+      coefHigh = 0;
+      coefLow = 0;
+    }
+
+  }
+
+  bool equalsIgnoreCase(const char* data, v_buff_size size, const char* text) {
+    v_buff_size textSize = (v_buff_size) std::strlen(text);
+    if(size != textSize) {
+      return false;
+    }
+    for(v_buff_size i = 0; i < size; i ++) {
+      char c = data[i];
+      if(c >= 'A' && c <= 'Z') {
+        c = (char) (c - 'A' + 'a');
+      }
+      if(c != text[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+}
+
+Decimal128::Decimal128()
+  : m_high((v_uint64) EXPONENT_BIAS << 49)
+  , m_low(0)
+{}
+
+Decimal128::Decimal128(v_uint64 high, v_uint64 low)
+  : m_high(high)
+  , m_low(low)
+{}
+
+Decimal128 Decimal128::fromParts(bool negative, v_uint64 coefHigh, v_uint64 coefLow, v_int32 exponent) {
+
+  if(coefHigh == 0 && coefLow == 0) {
+
+    if(exponent > EXPONENT_MAX) exponent = EXPONENT_MAX;
+    if(exponent < EXPONENT_MIN) exponent = EXPONENT_MIN;
+
+  } else {
+
+    while(exponent > EXPONENT_MAX) {
+      if(!lessThan(coefHigh, coefLow, POW10_33_HIGH, POW10_33_LOW)) {
+        throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromParts()]: Error. Exponent overflow.");
+      }
+      multiplyAdd10(coefHigh, coefLow, 0);
+      exponent --;
+    }
+
+    while(exponent < EXPONENT_MIN) {
+      v_uint64 high = coefHigh;
+      v_uint64 low = coefLow;
+      if(divide(high, low, 10) != 0) {
+        throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromParts()]: Error. Exponent underflow - inexact rounding.");
+      }
+      coefHigh = high;
+      coefLow = low;
+      exponent ++;
+    }
+
+  }
+
+  v_uint64 high = ((v_uint64) (exponent + EXPONENT_BIAS) << 49) | coefHigh;
+  if(negative) {
+    high |= SIGN_BIT;
+  }
+
+  return Decimal128(high, coefLow);
+
+}
+
+Decimal128 Decimal128::fromString(const char* data, v_buff_size size) {
+
+  const char* p = data;
+  const char* end = data + size;
+
+  bool negative = false;
+  if(p < end && (*p == '+' || *p == '-')) {
+    negative = (*p == '-');
+    p ++;
+  }
+
+  if(equalsIgnoreCase(p, end - p, "infinity") || equalsIgnoreCase(p, end - p, "inf")) {
+    return Decimal128(negative ? INFINITY_HIGH | SIGN_BIT : INFINITY_HIGH, 0);
+  }
+
+  if(equalsIgnoreCase(p, end - p, "nan")) {
+    return Decimal128(NAN_HIGH, 0);
+  }
+
+  v_uint64 coefHigh = 0;
+  v_uint64 coefLow = 0;
+  v_int32 digitsCount = 0;
+  v_int32 exponent = 0;
+
+  bool hasDigits = false;
+  bool hasPoint = false;
+
+  v_int32 roundDigit = -1;
+  bool roundSticky = false;
+
+  for(; p < end; p ++) {
+
+    char c = *p;
+
+    if(c == '.') {
+      if(hasPoint) {
+        throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromString()]: Error. Invalid decimal string.");
+      }
+      hasPoint = true;
+      continue;
+    }
+
+    if(c < '0' || c > '9') {
+      break;
+    }
+
+    hasDigits = true;
+    v_uint32 digit = (v_uint32) (c - '0');
+
+    if(digitsCount == 0 && digit == 0) {
+      if(hasPoint) exponent --;
+    } else if(digitsCount < MAX_DIGITS) {
+      multiplyAdd10(coefHigh, coefLow, digit);
+      digitsCount ++;
+      if(hasPoint) exponent --;
+    } else {
+      if(roundDigit < 0) {
+        roundDigit = (v_int32) digit;
+      } else if(digit != 0) {
+        roundSticky = true;
+      }
+      if(!hasPoint) exponent ++;
+    }
+
+  }
+
+  if(!hasDigits) {
+    throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromString()]: Error. Invalid decimal string.");
+  }
+
+  if(p < end && (*p == 'e' || *p == 'E')) {
+
+    p ++;
+
+    bool exponentNegative = false;
+    if(p < end && (*p == '+' || *p == '-')) {
+      exponentNegative = (*p == '-');
+      p ++;
+    }
+
+    if(p == end) {
+      throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromString()]: Error. Invalid exponent.");
+    }
+
+    v_int32 value = 0;
+    for(; p < end; p ++) {
+      if(*p < '0' || *p > '9') {
+        throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromString()]: Error. Invalid exponent.");
+      }
+      if(value < 100000) {
+        value = value * 10 + (*p - '0');
+      }
+    }
+
+    exponent += exponentNegative ? -value : value;
+
+  }
+
+  if(p != end) {
+    throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromString()]: Error. Invalid decimal string.");
+  }
+
+  if(roundDigit > 5 || (roundDigit == 5 && (roundSticky || (coefLow & 1) != 0))) {
+    coefLow ++;
+    if(coefLow == 0) {
+      coefHigh ++;
+    }
+    if(coefHigh == POW10_34_HIGH && coefLow == POW10_34_LOW) {
+      coefHigh = POW10_33_HIGH;
+      coefLow = POW10_33_LOW;
+      exponent ++;
+    }
+  }
+
+  return fromParts(negative, coefHigh, coefLow, exponent);
+
+}
+
+Decimal128 Decimal128::fromString(const oatpp::String& str) {
+  if(!str) {
+    throw std::runtime_error("[oatpp::mongo::bson::type::Decimal128::fromString()]: Error. String is null.");
+  }
+  return fromString(str->data(), (v_buff_size) str->size());
+}
+
+Decimal128 Decimal128::fromDouble(v_float64 value) {
+
+  if(std::isnan(value)) {
+    return Decimal128(NAN_HIGH, 0);
+  }
+
+  if(std::isinf(value)) {
+    return Decimal128(value < 0 ? INFINITY_HIGH | SIGN_BIT : INFINITY_HIGH, 0);
+  }
+
+  /* "-d.dddddddddddddde-ddd" - radix character is skipped, so the result doesn't depend on locale */
+  char buffer[40];
+  std::snprintf(buffer, sizeof(buffer), "%.14e", value);
+
+  const char* p = buffer;
+  bool negative = false;
+  if(*p == '-') {
+    negative = true;
+    p ++;
+  }
+
+  v_uint64 coefficient = 0;
+  for(; *p != 0 && *p != 'e'; p ++) {
+    if(*p >= '0' && *p <= '9') {
+      coefficient = coefficient * 10 + (v_uint64) (*p - '0');
+    }
+  }
+
+  v_int32 exponent = 0;
+  if(*p == 'e') {
+    exponent = (v_int32) std::strtol(p + 1, nullptr, 10);
+  }
+  exponent -= 14;
+
+  if(coefficient == 0) {
+    exponent = 0;
+  }
+
+  while(exponent < 0 && coefficient != 0 && coefficient % 10 == 0) {
+    coefficient /= 10;
+    exponent ++;
+  }
+
+  return fromParts(negative, 0, coefficient, exponent);
+
+}
+
+v_uint64 Decimal128::getHigh() const {
+  return m_high;
+}
+
+v_uint64 Decimal128::getLow() const {
+  return m_low;
+}
+
+bool Decimal128::isNaN() const {
+  return ((m_high >> 58) & 0x1F) == COMBINATION_NAN;
+}
+
+bool Decimal128::isInfinite() const {
+  return ((m_high >> 58) & 0x1F) == COMBINATION_INFINITY;
+}
+
+bool Decimal128::isNegative() const {
+  return (m_high & SIGN_BIT) != 0;
+}
+
+v_buff_size Decimal128::writeToBuffer(char* buffer) const {
+
+  char* p = buffer;
+
+  if(isNaN()) {
+    std::memcpy(p, "NaN", 3);
+    return 3;
+  }
+
+  if(isNegative()) {
+    *p ++ = '-';
+  }
+
+  if(isInfinite()) {
+    std::memcpy(p, "Infinity", 8);
+    return (p - buffer) + 8;
+  }
+
+  v_int32 exponent;
+  v_uint64 coefHigh, coefLow;
+  decode(m_high, m_low, exponent, coefHigh, coefLow);
+
+  char digits[36];
+  v_int32 digitsCount = writeDigits(coefHigh, coefLow, digits);
+  v_int32 adjusted = exponent + digitsCount - 1;
+
+  if(exponent > 0 || adjusted < -6) {
+
+    *p ++ = digits[0];
+    if(digitsCount > 1) {
+      *p ++ = '.';
+      std::memcpy(p, digits + 1, digitsCount - 1);
+      p += digitsCount - 1;
+    }
+
+    *p ++ = 'E';
+    if(adjusted < 0) {
+      *p ++ = '-';
+      adjusted = -adjusted;
+    } else {
+      *p ++ = '+';
+    }
+
+    char tmp[8];
+    v_int32 count = 0;
+    do {
+      tmp[count ++] = (char) ('0' + adjusted % 10);
+      adjusted /= 10;
+    } while(adjusted != 0);
+    while(count > 0) {
+      *p ++ = tmp[-- count];
+    }
+
+  } else if(exponent == 0) {
+
+    std::memcpy(p, digits, digitsCount);
+    p += digitsCount;
+
+  } else {
+
+    v_int32 radixPosition = digitsCount + exponent;
+
+    if(radixPosition > 0) {
+      std::memcpy(p, digits, radixPosition);
+      p += radixPosition;
+      *p ++ = '.';
+      std::memcpy(p, digits + radixPosition, digitsCount - radixPosition);
+      p += digitsCount - radixPosition;
+    } else {
+      *p ++ = '0';
+      *p ++ = '.';
+      for(v_int32 i = radixPosition; i < 0; i ++) {
+        *p ++ = '0';
+      }
+      std::memcpy(p, digits, digitsCount);
+      p += digitsCount;
+    }
+
+  }
+
+  return p - buffer;
+
+}
+
+oatpp::String Decimal128::toString() const {
+  char buffer[MAX_STRING_SIZE];
+  v_buff_size size = writeToBuffer(buffer);
+  return oatpp::String(buffer, size);
+}
+
+v_float64 Decimal128::toDouble() const {
+
+  static const v_float64 POW10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  if(isNaN()) {
+    return std::numeric_limits<v_float64>::quiet_NaN();
+  }
+
+  bool negative = isNegative();
+
+  if(isInfinite()) {
+    return negative ? -std::numeric_limits<v_float64>::infinity() : std::numeric_limits<v_float64>::infinity();
+  }
+
+  v_int32 exponent;
+  v_uint64 coefHigh, coefLow;
+  decode(m_high, m_low, exponent, coefHigh, coefLow);
+
+  if(coefHigh == 0 && coefLow < (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+    /* Both operands are exact - a single correctly rounded operation. */
+    v_float64 result = (v_float64) coefLow;
+    result = exponent >= 0 ? result * POW10[exponent] : result / POW10[-exponent];
+    return negative ? -result : result;
+  }
+
+  /* "-<digits>E<exponent>" - no radix character, so parsing doesn't depend on locale */
+  char buffer[48];
+  char* p = buffer;
+  if(negative) {
+    *p ++ = '-';
+  }
+  p += writeDigits(coefHigh, coefLow, p);
+  std::snprintf(p, sizeof(buffer) - (p - buffer), "E%d", (int) exponent);
+
+  return std::strtod(buffer, nullptr);
+
+}
+
+bool Decimal128::operator==(const Decimal128 &other) const {
+  return m_high == other.m_high && m_low == other.m_low;
+}
+
+bool Decimal128::operator!=(const Decimal128 &other) const {
+  return !operator==(other);
+}
+
+}}}}
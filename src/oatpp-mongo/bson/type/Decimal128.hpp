@@ -0,0 +1,180 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_type_Decimal128_hpp
+#define oatpp_mongo_bson_type_Decimal128_hpp
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace mongo { namespace bson { namespace type {
+
+/**
+ * BSON Decimal128 implementation. <br>
+ * IEEE 754-2008 128-bit decimal floating point in the Binary Integer Decimal (BID) encoding. <br>
+ * Value is stored as is - construction from wire data doesn't allocate or convert.
+ */
+class Decimal128 {
+public:
+
+  /**
+   * Size of Decimal128 data.
+   */
+  static constexpr v_buff_size DATA_SIZE = 16;
+
+  /**
+   * Max size of string representation (without terminating zero).
+   */
+  static constexpr v_buff_size MAX_STRING_SIZE = 42;
+
+  /**
+   * Max number of significant digits.
+   */
+  static constexpr v_int32 MAX_DIGITS = 34;
+
+  /**
+   * Exponent bias.
+   */
+  static constexpr v_int32 EXPONENT_BIAS = 6176;
+
+  /**
+   * Min exponent.
+   */
+  static constexpr v_int32 EXPONENT_MIN = -6176;
+
+  /**
+   * Max exponent.
+   */
+  static constexpr v_int32 EXPONENT_MAX = 6111;
+
+private:
+  v_uint64 m_high;
+  v_uint64 m_low;
+private:
+  static Decimal128 fromParts(bool negative, v_uint64 coefHigh, v_uint64 coefLow, v_int32 exponent);
+public:
+
+  /**
+   * Constructor. Zero value (`0`).
+   */
+  Decimal128();
+
+  /**
+   * Constructor.
+   * @param high - high 64 bits of value.
+   * @param low - low 64 bits of value.
+   */
+  Decimal128(v_uint64 high, v_uint64 low);
+
+  /**
+   * Parse Decimal128 from its string representation. <br>
+   * Accepts decimal and scientific notation, `Infinity`, `Inf` and `NaN` (case-insensitive). <br>
+   * Values with more than &l:Decimal128::MAX_DIGITS; significant digits are rounded half to even.
+   * @param data - pointer to string data.
+   * @param size - size of string.
+   * @return - &l:Decimal128;.
+   * @throws - `std::runtime_error` if string is not a valid decimal or can't be represented.
+   */
+  static Decimal128 fromString(const char* data, v_buff_size size);
+
+  /**
+   * Parse Decimal128 from its string representation.
+   * @param str - &id:oatpp::String;.
+   * @return - &l:Decimal128;.
+   * @throws - `std::runtime_error` if string is not a valid decimal or can't be represented.
+   */
+  static Decimal128 fromString(const oatpp::String& str);
+
+  /**
+   * Convert double to Decimal128. <br>
+   * The value is rounded to 15 significant digits (the precision of double) and trailing fractional zeros are dropped,
+   * so that `0.1` becomes `0.1` and not `0.1000000000000000055511151231257827`.
+   * @param value
+   * @return - &l:Decimal128;.
+   */
+  static Decimal128 fromDouble(v_float64 value);
+
+  /**
+   * Get high 64 bits of value.
+   * @return
+   */
+  v_uint64 getHigh() const;
+
+  /**
+   * Get low 64 bits of value.
+   * @return
+   */
+  v_uint64 getLow() const;
+
+  /**
+   * Check if value is NaN.
+   * @return
+   */
+  bool isNaN() const;
+
+  /**
+   * Check if value is positive or negative infinity.
+   * @return
+   */
+  bool isInfinite() const;
+
+  /**
+   * Check if sign bit is set.
+   * @return
+   */
+  bool isNegative() const;
+
+  /**
+   * Write string representation to buffer. Doesn't allocate.
+   * @param buffer - buffer of at least &l:Decimal128::MAX_STRING_SIZE; bytes.
+   * @return - number of bytes written.
+   */
+  v_buff_size writeToBuffer(char* buffer) const;
+
+  /**
+   * To string.
+   * @return
+   */
+  oatpp::String toString() const;
+
+  /**
+   * Convert to double. <br>
+   * Values with up to 53-bit coefficient and exponent within [-22, 22] are converted exactly without parsing.
+   * @return
+   */
+  v_float64 toDouble() const;
+
+  /**
+   * Bitwise equality.
+   * @param other
+   * @return
+   */
+  bool operator==(const Decimal128 &other) const;
+  bool operator!=(const Decimal128 &other) const;
+
+};
+
+}}}}
+
+#endif // oatpp_mongo_bson_type_Decimal128_hpp
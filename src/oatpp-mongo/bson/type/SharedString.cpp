@@ -0,0 +1,78 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "SharedString.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mongo { namespace bson { namespace type {
+
+SharedString::SharedString()
+  : m_handle(nullptr)
+  , m_data(nullptr)
+  , m_size(0)
+{}
+
+SharedString::SharedString(const oatpp::String& str)
+  : m_handle(str.getPtr())
+  , m_data(str ? str->data() : nullptr)
+  , m_size(str ? str->size() : 0)
+{}
+
+SharedString::SharedString(const std::shared_ptr<void>& handle, const char* data, v_buff_size size)
+  : m_handle(handle)
+  , m_data(data)
+  , m_size(size)
+{}
+
+const std::shared_ptr<void>& SharedString::getHandle() const {
+  return m_handle;
+}
+
+const char* SharedString::getData() const {
+  return m_data;
+}
+
+v_buff_size SharedString::getSize() const {
+  return m_size;
+}
+
+bool SharedString::equals(const char* data, v_buff_size size) const {
+  return m_size == size && (m_size == 0 || m_data == data || std::memcmp(m_data, data, m_size) == 0);
+}
+
+oatpp::String SharedString::toString() const {
+  return oatpp::String(m_data, m_size);
+}
+
+bool SharedString::operator==(const SharedString &other) const {
+  return equals(other.m_data, other.m_size);
+}
+
+bool SharedString::operator!=(const SharedString &other) const {
+  return !operator==(other);
+}
+
+}}}}
@@ -0,0 +1,103 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mongo_bson_type_SharedString_hpp
+#define oatpp_mongo_bson_type_SharedString_hpp
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace mongo { namespace bson { namespace type {
+
+/**
+ * Immutable UTF-8 string sharing ownership of the buffer it points into. <br>
+ * Deserialized from BSON string without copying - the string references the source document
+ * (see &id:oatpp::mongo::bson::mapping::Deserializer::SourceBufferScope;) and keeps it alive.
+ */
+class SharedString {
+private:
+  std::shared_ptr<void> m_handle;
+  const char* m_data;
+  v_buff_size m_size;
+public:
+
+  /**
+   * Constructor. Empty string.
+   */
+  SharedString();
+
+  /**
+   * Constructor. References the whole string.
+   * @param str - &id:oatpp::String;. The string is referenced, not copied.
+   */
+  SharedString(const oatpp::String& str);
+
+  /**
+   * Constructor. References the memory region kept alive by `handle`.
+   * @param handle - memory handle.
+   * @param data - pointer to string data.
+   * @param size - size of string (without terminating zero).
+   */
+  SharedString(const std::shared_ptr<void>& handle, const char* data, v_buff_size size);
+
+  /**
+   * Get memory handle keeping the data alive.
+   * @return
+   */
+  const std::shared_ptr<void>& getHandle() const;
+
+  /**
+   * Get pointer to string data. Data is not guaranteed to be zero-terminated.
+   * @return
+   */
+  const char* getData() const;
+
+  /**
+   * Get size of string.
+   * @return
+   */
+  v_buff_size getSize() const;
+
+  /**
+   * Compare with memory region.
+   * @param data
+   * @param size
+   * @return
+   */
+  bool equals(const char* data, v_buff_size size) const;
+
+  /**
+   * Copy to &id:oatpp::String;.
+   * @return
+   */
+  oatpp::String toString() const;
+
+  bool operator==(const SharedString &other) const;
+  bool operator!=(const SharedString &other) const;
+
+};
+
+}}}}
+
+#endif // oatpp_mongo_bson_type_SharedString_hpp
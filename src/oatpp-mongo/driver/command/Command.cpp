@@ -0,0 +1,77 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Command.hpp"
+
+namespace oatpp { namespace mongo { namespace driver { namespace command {
+
+v_buff_size Command::computeMessageOverhead(const oatpp::String& sequenceIdentifier) {
+  v_buff_size headerSize = 16 + 4; // message header and flags
+  v_buff_size sequenceHeaderSize = 1 + 4 + (v_buff_size) sequenceIdentifier->size() + 1;
+  return headerSize + sequenceHeaderSize;
+}
+
+void Command::measureBody(const oatpp::Void& body, ObjectMapper* objectMapper) {
+  if(m_bodyObjectMapper != objectMapper) {
+    m_bodySize = 1 + objectMapper->computeSize(body); // section kind and document
+    m_bodyObjectMapper = objectMapper;
+  }
+}
+
+void Command::checkDocumentSize(v_buff_size documentSize, v_buff_size payloadSize) const {
+  if(documentSize > m_maxBsonObjectSize) {
+    throw std::runtime_error("[oatpp::mongo::driver::command::Command::checkDocumentSize()]: Error. "
+                             "Document size exceeds maxBsonObjectSize.");
+  }
+  if(m_messageOverhead + m_bodySize + payloadSize + documentSize > m_maxMessageSize) {
+    throw std::runtime_error("[oatpp::mongo::driver::command::Command::checkDocumentSize()]: Error. "
+                             "Message size exceeds maxMessageSizeBytes.");
+  }
+}
+
+void Command::checkMessageSize(v_buff_size messageSize) const {
+  if(messageSize > m_maxMessageSize) {
+    throw std::runtime_error("[oatpp::mongo::driver::command::Command::checkMessageSize()]: Error. "
+                             "Message size exceeds maxMessageSizeBytes.");
+  }
+}
+
+v_buff_size Command::appendDocument(bson::SliceList* slices,
+                                    v_buff_size payloadSize,
+                                    const oatpp::Void& document,
+                                    ObjectMapper* objectMapper) const
+{
+
+  checkDocumentSize(objectMapper->computeSize(document), payloadSize);
+
+  v_buff_size sizeBefore = slices->getSize();
+  objectMapper->writeToSlices(slices, document);
+  v_buff_size size = slices->getSize() - sizeBefore;
+
+  return size;
+
+}
+
+}}}}
@@ -40,7 +40,77 @@ class Command {
 public:
   typedef bson::mapping::ObjectMapper ObjectMapper;
 public:
+
+  /**
+   * Default max size of a single BSON document accepted by the server - `maxBsonObjectSize`.
+   */
+  static constexpr v_buff_size DEFAULT_MAX_BSON_OBJECT_SIZE = 16 * 1024 * 1024;
+
+  /**
+   * Default max size of a wire message accepted by the server - `maxMessageSizeBytes`.
+   */
+  static constexpr v_buff_size DEFAULT_MAX_MESSAGE_SIZE = 48000000;
+
+protected:
+  v_buff_size m_maxBsonObjectSize = DEFAULT_MAX_BSON_OBJECT_SIZE;
+  v_buff_size m_maxMessageSize = DEFAULT_MAX_MESSAGE_SIZE;
+
+  /*
+   * Size of the message header, flags and header of the documents section. See `computeMessageOverhead()`.
+   */
+  v_buff_size m_messageOverhead = 0;
+
+  /*
+   * Size of the body section as encoded by `m_bodyObjectMapper`. See `measureBody()`.
+   */
+  v_buff_size m_bodySize = 0;
+  const ObjectMapper* m_bodyObjectMapper = nullptr;
+protected:
+
+  /*
+   * Compute size of the message without the body section and documents.
+   */
+  static v_buff_size computeMessageOverhead(const oatpp::String& sequenceIdentifier);
+
+  /*
+   * Measure the body section with the mapper of the caller. Measured again only if the mapper has changed.
+   * The exact size of the body is checked by `toMessage()` once the body is encoded with the command mapper.
+   */
+  void measureBody(const oatpp::Void& body, ObjectMapper* objectMapper);
+
+  /*
+   * Check that the document of `documentSize` can be added to the command which already holds `payloadSize` bytes of documents.
+   * Throws `std::runtime_error` if server limits would be exceeded.
+   */
+  void checkDocumentSize(v_buff_size documentSize, v_buff_size payloadSize) const;
+
+  /*
+   * Check size of the whole message, header included.
+   * Throws `std::runtime_error` if it exceeds `maxMessageSizeBytes`.
+   */
+  void checkMessageSize(v_buff_size messageSize) const;
+
+  /*
+   * Check size of the document with `ObjectMapper::computeSize()`, then serialize it and append to `slices`.
+   * If server limits would be exceeded `std::runtime_error` is thrown and nothing is serialized.
+   * @return - size of the appended document.
+   */
+  v_buff_size appendDocument(bson::SliceList* slices, v_buff_size payloadSize, const oatpp::Void& document, ObjectMapper* objectMapper) const;
+
+public:
+
+  /**
+   * Set server size limits. Use values reported by the `hello` command.
+   * @param maxBsonObjectSize - `maxBsonObjectSize`.
+   * @param maxMessageSize - `maxMessageSizeBytes`.
+   */
+  void setSizeLimits(v_buff_size maxBsonObjectSize, v_buff_size maxMessageSize) {
+    m_maxBsonObjectSize = maxBsonObjectSize;
+    m_maxMessageSize = maxMessageSize;
+  }
+
   virtual wire::Message toMessage(ObjectMapper* commandObjectMapper) = 0;
+
 };
 
 }}}}
@@ -26,6 +26,7 @@
 #include "Delete.hpp"
 
 #include "oatpp-mongo/driver/wire/Message.hpp"
+#include "oatpp-mongo/bson/BufferArena.hpp"
 
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
@@ -51,15 +52,15 @@ wire::Message Delete::toMessage(ObjectMapper* commandObjectMapper) {
   wire::OpMsg msg;
 
   auto bodySection = std::make_shared<wire::BodySection>();
-  bodySection->document = commandObjectMapper->writeToString(m_deleteDto);
+  bodySection->document = commandObjectMapper->writeToStringPooled(m_deleteDto);
 
   msg.sections.push_back(bodySection);
   msg.sections.push_back(m_documents);
 
-  data::stream::BufferOutputStream payloadStream;
-  msg.writeToStream(&payloadStream);
+  auto payloadStream = bson::BufferArena::getThreadLocal().borrow();
+  msg.writeToStream(payloadStream.get());
 
-  auto data = payloadStream.toString();
+  auto data = payloadStream->toString();
 
   return wire::Message(16 + (v_int32) data->size(), wire::OpMsg::OP_CODE, data);
 
@@ -26,6 +26,7 @@
 #include "Find.hpp"
 
 #include "oatpp-mongo/driver/wire/Message.hpp"
+#include "oatpp-mongo/bson/BufferArena.hpp"
 
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
@@ -43,14 +44,14 @@ wire::Message Find::toMessage(ObjectMapper* commandObjectMapper) {
   wire::OpMsg msg;
 
   auto bodySection = std::make_shared<wire::BodySection>();
-  bodySection->document = commandObjectMapper->writeToString(m_findDto);
+  bodySection->document = commandObjectMapper->writeToStringPooled(m_findDto);
 
   msg.sections.push_back(bodySection);
 
-  data::stream::BufferOutputStream payloadStream;
-  msg.writeToStream(&payloadStream);
+  auto payloadStream = bson::BufferArena::getThreadLocal().borrow();
+  msg.writeToStream(payloadStream.get());
 
-  auto data = payloadStream.toString();
+  auto data = payloadStream->toString();
 
   return wire::Message(16 + (v_int32) data->size(), wire::OpMsg::OP_CODE, data);
 
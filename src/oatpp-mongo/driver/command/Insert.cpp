@@ -26,9 +26,12 @@
 #include "Insert.hpp"
 
 #include "oatpp-mongo/driver/wire/Message.hpp"
+#include "oatpp-mongo/bson/WorkerPool.hpp"
 
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
+#include <algorithm>
+
 namespace oatpp { namespace mongo { namespace driver { namespace command {
 
 Insert::Insert(const oatpp::String &databaseName,
@@ -36,14 +39,86 @@ Insert::Insert(const oatpp::String &databaseName,
                const oatpp::Object<WriteConcern> &writeConcern)
   : m_insertDto(InsertDto::createShared())
   , m_documents(std::make_shared<wire::DocumentSequenceSection>("documents"))
+  , m_documentsSize(0)
 {
+  m_documents->documentSlices = std::make_shared<bson::SliceList>();
   m_insertDto->databaseName = databaseName;
   m_insertDto->collectionName = collectionName;
   m_insertDto->writeConcern = writeConcern;
+  m_messageOverhead = computeMessageOverhead(m_documents->identifier);
 }
 
 void Insert::addDocument(const oatpp::String &document) {
-  m_documents->documents.push_back(document);
+  checkDocumentSize(document->size(), m_documentsSize);
+  m_documents->documentSlices->append(document);
+  m_documentsSize += document->size();
+}
+
+void Insert::addDocument(const oatpp::Void& document, ObjectMapper* objectMapper) {
+  measureBody(m_insertDto, objectMapper);
+  m_documentsSize += appendDocument(m_documents->documentSlices.get(), m_documentsSize, document, objectMapper);
+}
+
+void Insert::addDocuments(const std::vector<oatpp::Void>& documents, ObjectMapper* objectMapper, v_int32 threadsCount) {
+
+  /* Not worth a separate batch for less documents */
+  static constexpr v_buff_size MIN_DOCUMENTS_PER_BATCH = 64;
+
+  const v_buff_size documentsCount = documents.size();
+  if(documentsCount == 0) {
+    return;
+  }
+
+  auto& pool = bson::WorkerPool::getDefault();
+
+  if(threadsCount <= 0) {
+    threadsCount = pool.getThreadsCount() + 1;
+  }
+  v_buff_size maxBatches = (documentsCount + MIN_DOCUMENTS_PER_BATCH - 1) / MIN_DOCUMENTS_PER_BATCH;
+  const v_int32 batchesCount = (v_int32) std::min<v_buff_size>(threadsCount, maxBatches);
+
+  measureBody(m_insertDto, objectMapper);
+
+  /* Check limits before anything is serialized */
+  std::vector<v_buff_size> batchSizes(batchesCount, 0);
+  pool.run(batchesCount, [&](v_int32 index) {
+    v_buff_size begin = documentsCount * index / batchesCount;
+    v_buff_size end = documentsCount * (index + 1) / batchesCount;
+    for(v_buff_size i = begin; i < end; i ++) {
+      v_buff_size size = objectMapper->computeSize(documents[i]);
+      checkDocumentSize(size, 0);
+      batchSizes[index] += size;
+    }
+  });
+
+  v_buff_size batchSize = 0;
+  for(auto size : batchSizes) {
+    batchSize += size;
+  }
+
+  checkDocumentSize(0, m_documentsSize + batchSize);
+
+  std::vector<std::shared_ptr<bson::SliceList>> batches(batchesCount);
+  pool.run(batchesCount, [&](v_int32 index) {
+    v_buff_size begin = documentsCount * index / batchesCount;
+    v_buff_size end = documentsCount * (index + 1) / batchesCount;
+    auto slices = std::make_shared<bson::SliceList>();
+    for(v_buff_size i = begin; i < end; i ++) {
+      objectMapper->writeToSlices(slices.get(), documents[i]);
+    }
+    batches[index] = slices;
+  });
+
+  batchSize = 0;
+  for(auto& slices : batches) {
+    batchSize += slices->getSize();
+  }
+
+  for(auto& slices : batches) {
+    m_documents->documentSlices->splice(slices);
+  }
+  m_documentsSize += batchSize;
+
 }
 
 wire::Message Insert::toMessage(ObjectMapper* commandObjectMapper) {
@@ -51,17 +126,16 @@ wire::Message Insert::toMessage(ObjectMapper* commandObjectMapper) {
   wire::OpMsg msg;
 
   auto bodySection = std::make_shared<wire::BodySection>();
-  bodySection->document = commandObjectMapper->writeToString(m_insertDto);
+  bodySection->document = commandObjectMapper->writeToStringPooled(m_insertDto);
 
   msg.sections.push_back(bodySection);
   msg.sections.push_back(m_documents);
 
-  data::stream::BufferOutputStream payloadStream;
-  msg.writeToStream(&payloadStream);
-
-  auto data = payloadStream.toString();
+  auto payload = std::make_shared<bson::SliceList>();
+  msg.writeToSlices(payload.get());
+  checkMessageSize(16 + payload->getSize());
 
-  return wire::Message(16 + (v_int32) data->size(), wire::OpMsg::OP_CODE, data);
+  return wire::Message(16 + (v_int32) payload->getSize(), wire::OpMsg::OP_CODE, payload);
 
 }
 
@@ -35,6 +35,8 @@
 #include "oatpp/core/Types.hpp"
 #include "oatpp/core/macro/codegen.hpp"
 
+#include <vector>
+
 namespace oatpp { namespace mongo { namespace driver { namespace command {
 
 #include OATPP_CODEGEN_BEGIN(DTO)
@@ -58,14 +60,69 @@ private:
 private:
   oatpp::Object<InsertDto> m_insertDto;
   std::shared_ptr<wire::DocumentSequenceSection> m_documents;
+  v_buff_size m_documentsSize;
 public:
 
   Insert(const oatpp::String& databaseName,
          const oatpp::String& collectionName,
          const oatpp::Object<WriteConcern>& writeConcern = nullptr);
 
+  /**
+   * Add serialized BSON document. <br>
+   * Documents exceeding server limits (see &l:Command::setSizeLimits ();) are rejected -
+   * `std::runtime_error` is thrown and the command is left unchanged. The size of the command body is
+   * counted only once it was measured by &l:Insert::addDocument (); with an object mapper -
+   * otherwise it's checked by &l:Insert::toMessage ();.
+   * @param document - BSON document.
+   */
   void addDocument(const oatpp::String& document);
 
+  /**
+   * Serialize and add document. <br>
+   * The size of the document is computed before it is serialized - documents exceeding server limits
+   * (see &l:Command::setSizeLimits ();) are rejected, `std::runtime_error` is thrown and the command is left unchanged. <br>
+   * Large string values of the document are not copied but referenced until the message is written to the connection.
+   * @param document - document to add.
+   * @param objectMapper - BSON &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   */
+  void addDocument(const oatpp::Void& document, ObjectMapper* objectMapper);
+
+  /**
+   * Serialize and add batch of documents in parallel. <br>
+   * Documents are split into contiguous ranges serialized on &id:oatpp::mongo::bson::WorkerPool::getDefault;,
+   * each to its own &id:oatpp::mongo::bson::SliceList;. The lists are then spliced in the original order - nothing is copied. <br>
+   * Sizes of all documents are computed and checked against server limits before any document is serialized.
+   * @param documents - documents to add.
+   * @param objectMapper - BSON &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   * @param threadsCount - max count of ranges serialized concurrently. `0` - count of pool workers plus the calling thread.
+   */
+  void addDocuments(const std::vector<oatpp::Void>& documents, ObjectMapper* objectMapper, v_int32 threadsCount = 0);
+
+  /**
+   * Serialize and add batch of documents in parallel.
+   * See &l:Insert::addDocuments ();.
+   * @tparam Collection - collection of DTOs, ex.: `oatpp::Vector<oatpp::Object<T>>`, `oatpp::List<oatpp::Object<T>>`.
+   * @param documents - documents to add.
+   * @param objectMapper - BSON &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   * @param threadsCount - max count of ranges serialized concurrently. `0` - count of pool workers plus the calling thread.
+   */
+  template<class Collection>
+  void addDocuments(const Collection& documents, ObjectMapper* objectMapper, v_int32 threadsCount = 0) {
+    std::vector<oatpp::Void> list;
+    list.reserve(documents->size());
+    for(auto& document : *documents) {
+      list.push_back(document);
+    }
+    addDocuments(list, objectMapper, threadsCount);
+  }
+
+  /**
+   * Create wire message of the command. <br>
+   * The message references the documents of the command in place - no more documents can be added afterwards.
+   * @param commandObjectMapper - BSON &id:oatpp::mongo::bson::mapping::ObjectMapper; for the command body.
+   * @return - &id:oatpp::mongo::driver::wire::Message; holding `dataSlices` - `data` is `nullptr`.
+   * Use &id:oatpp::mongo::driver::wire::Message::getData; to get message data as a single string.
+   */
   wire::Message toMessage(ObjectMapper* commandObjectMapper) override;
 
 };
@@ -36,14 +36,24 @@ Update::Update(const oatpp::String &databaseName,
                const oatpp::Object<WriteConcern> &writeConcern)
   : m_updateDto(UpdateDto::createShared())
   , m_documents(std::make_shared<wire::DocumentSequenceSection>("updates"))
+  , m_documentsSize(0)
 {
+  m_documents->documentSlices = std::make_shared<bson::SliceList>();
   m_updateDto->databaseName = databaseName;
   m_updateDto->collectionName = collectionName;
   m_updateDto->writeConcern = writeConcern;
+  m_messageOverhead = computeMessageOverhead(m_documents->identifier);
 }
 
 void Update::addDocument(const oatpp::String &document) {
-  m_documents->documents.push_back(document);
+  checkDocumentSize(document->size(), m_documentsSize);
+  m_documents->documentSlices->append(document);
+  m_documentsSize += document->size();
+}
+
+void Update::addDocument(const oatpp::Void& document, ObjectMapper* objectMapper) {
+  measureBody(m_updateDto, objectMapper);
+  m_documentsSize += appendDocument(m_documents->documentSlices.get(), m_documentsSize, document, objectMapper);
 }
 
 wire::Message Update::toMessage(ObjectMapper* commandObjectMapper) {
@@ -51,17 +61,16 @@ wire::Message Update::toMessage(ObjectMapper* commandObjectMapper) {
   wire::OpMsg msg;
 
   auto bodySection = std::make_shared<wire::BodySection>();
-  bodySection->document = commandObjectMapper->writeToString(m_updateDto);
+  bodySection->document = commandObjectMapper->writeToStringPooled(m_updateDto);
 
   msg.sections.push_back(bodySection);
   msg.sections.push_back(m_documents);
 
-  data::stream::BufferOutputStream payloadStream;
-  msg.writeToStream(&payloadStream);
-
-  auto data = payloadStream.toString();
+  auto payload = std::make_shared<bson::SliceList>();
+  msg.writeToSlices(payload.get());
+  checkMessageSize(16 + payload->getSize());
 
-  return wire::Message(16 + (v_int32) data->size(), wire::OpMsg::OP_CODE, data);
+  return wire::Message(16 + (v_int32) payload->getSize(), wire::OpMsg::OP_CODE, payload);
 
 }
 
@@ -58,14 +58,40 @@ private:
 private:
   oatpp::Object<UpdateDto> m_updateDto;
   std::shared_ptr<wire::DocumentSequenceSection> m_documents;
+  v_buff_size m_documentsSize;
 public:
 
   Update(const oatpp::String& databaseName,
          const oatpp::String& collectionName,
          const oatpp::Object<WriteConcern>& writeConcern = nullptr);
 
+  /**
+   * Add serialized BSON document. <br>
+   * Documents exceeding server limits (see &l:Command::setSizeLimits ();) are rejected -
+   * `std::runtime_error` is thrown and the command is left unchanged. The size of the command body is
+   * counted only once it was measured by &l:Update::addDocument (); with an object mapper -
+   * otherwise it's checked by &l:Update::toMessage ();.
+   * @param document - BSON document.
+   */
   void addDocument(const oatpp::String& document);
 
+  /**
+   * Serialize and add document. <br>
+   * The size of the document is computed before it is serialized - documents exceeding server limits
+   * (see &l:Command::setSizeLimits ();) are rejected, `std::runtime_error` is thrown and the command is left unchanged. <br>
+   * Large string values of the document are not copied but referenced until the message is written to the connection.
+   * @param document - document to add.
+   * @param objectMapper - BSON &id:oatpp::mongo::bson::mapping::ObjectMapper;.
+   */
+  void addDocument(const oatpp::Void& document, ObjectMapper* objectMapper);
+
+  /**
+   * Create wire message of the command. <br>
+   * The message references the documents of the command in place - no more documents can be added afterwards.
+   * @param commandObjectMapper - BSON &id:oatpp::mongo::bson::mapping::ObjectMapper; for the command body.
+   * @return - &id:oatpp::mongo::driver::wire::Message; holding `dataSlices` - `data` is `nullptr`.
+   * Use &id:oatpp::mongo::driver::wire::Message::getData; to get message data as a single string.
+   */
   wire::Message toMessage(ObjectMapper* commandObjectMapper) override;
 
 };
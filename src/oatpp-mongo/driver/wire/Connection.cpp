@@ -36,25 +36,21 @@ Connection::Connection(const provider::ResourceHandle<data::stream::IOStream>& c
 
 v_io_size Connection::write(const Message& message) {
 
-  if(message.header.messageLength != 16 + message.data->size()) {
+  if(message.header.messageLength != 16 + message.getDataSize()) {
     throw std::runtime_error("[oatpp::mongo::driver::wire::Connection::write()]: Error. Invalid message header.");
   }
 
-  data::stream::BufferOutputStream stream(16);
-  message.header.writeToStream(&stream);
+  /* The header and small slices of data are gathered into a single write */
+  bson::SliceList frame(16);
+  message.header.writeToStream(frame.getScratchStream());
 
-  auto res1 = m_connection.object->writeExactSizeDataSimple(stream.getData(), stream.getCurrentPosition());
-
-  if(res1 < stream.getCurrentPosition()) {
-    return res1;
+  if(message.hasDataSlices()) {
+    frame.splice(message.dataSlices);
+  } else {
+    frame.addReference(message.data);
   }
 
-  auto res2 = m_connection.object->writeExactSizeDataSimple(message.data->data(), message.data->size());
-  if(res2 < 0) {
-    return res2;
-  }
-
-  return res1 + res2;
+  return frame.writeToStream(m_connection.object.get());
 
 }
 
@@ -78,6 +74,7 @@ v_io_size Connection::read(Message& message) {
   }
 
   message.data = dataBuffer;
+  message.dataSlices = nullptr;
 
   return res1 + res2;
 
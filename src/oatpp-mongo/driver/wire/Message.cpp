@@ -57,4 +57,31 @@ Message::Message(v_int32 length, v_int32 opCode, const oatpp::String& msgData)
   , data(msgData)
 {}
 
+Message::Message(v_int32 length, v_int32 opCode, const std::shared_ptr<bson::SliceList>& msgDataSlices)
+  : header(length, opCode)
+  , dataSlices(msgDataSlices)
+{}
+
+bool Message::hasDataSlices() const {
+  if((data == nullptr) == (dataSlices == nullptr)) {
+    throw std::runtime_error("[oatpp::mongo::driver::wire::Message::hasDataSlices()]: Error. "
+                             "Message should hold either data or dataSlices.");
+  }
+  return dataSlices != nullptr;
+}
+
+v_buff_size Message::getDataSize() const {
+  if(hasDataSlices()) {
+    return dataSlices->getSize();
+  }
+  return data->size();
+}
+
+oatpp::String Message::getData() const {
+  if(hasDataSlices()) {
+    return dataSlices->toString();
+  }
+  return data;
+}
+
 }}}}
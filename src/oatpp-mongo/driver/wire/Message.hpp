@@ -26,6 +26,8 @@
 #ifndef oatpp_mongo_driver_wire_Message_hpp
 #define oatpp_mongo_driver_wire_Message_hpp
 
+#include "oatpp-mongo/bson/SliceList.hpp"
+
 #include "oatpp/core/data/stream/Stream.hpp"
 #include "oatpp/core/parser/Caret.hpp"
 #include "oatpp/core/Types.hpp"
@@ -51,15 +53,53 @@ public:
 };
 
 /**
- * MongoDB wire message.
+ * MongoDB wire message. <br>
+ * Message data is held in exactly one of two forms - `data` or `dataSlices`. <br>
+ * Messages read from the connection and messages of commands without document sequences hold `data`.
+ * Messages of &id:oatpp::mongo::driver::command::Insert; and &id:oatpp::mongo::driver::command::Update; hold `dataSlices`
+ * referencing documents of the command in place. <br>
+ * Use &l:Message::hasDataSlices (); to check the form, or &l:Message::getData (); to get data in either form.
  */
 struct Message {
 
   Message() = default;
   Message(v_int32 length, v_int32 opCode, const oatpp::String& msgData);
+  Message(v_int32 length, v_int32 opCode, const std::shared_ptr<bson::SliceList>& msgDataSlices);
 
   MessageHeader header;
+
+  /**
+   * Message data. `nullptr` if the message holds `dataSlices`.
+   */
   oatpp::String data;
+
+  /**
+   * Message data as a list of slices. `nullptr` if the message holds `data`.
+   */
+  std::shared_ptr<bson::SliceList> dataSlices;
+
+  /**
+   * Check if message data is held as `dataSlices`.
+   * @return - `true` if message data is held as `dataSlices`, `false` if it's held as `data`.
+   * @throws - `std::runtime_error` if the message holds both forms or none.
+   */
+  bool hasDataSlices() const;
+
+  /**
+   * Get size of message data in either form.
+   * @return - size of message data.
+   * @throws - `std::runtime_error` if the message holds both forms or none.
+   */
+  v_buff_size getDataSize() const;
+
+  /**
+   * Get message data as a single string. <br>
+   * If the message holds `dataSlices` - slices are joined into a new string, referenced data is copied.
+   * @return - message data.
+   * @throws - `std::runtime_error` if the message holds both forms or none.
+   */
+  oatpp::String getData() const;
+
 };
 
 }}}}
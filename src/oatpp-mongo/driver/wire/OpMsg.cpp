@@ -34,7 +34,7 @@ namespace oatpp { namespace mongo { namespace driver { namespace wire {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Message
 
-void OpMsg::writeToStream(data::stream::ConsistentOutputStream* stream) {
+v_int32 OpMsg::getFlags() const {
 
   v_int32 flags = 0;
 
@@ -42,7 +42,13 @@ void OpMsg::writeToStream(data::stream::ConsistentOutputStream* stream) {
   if(moreToCome) flags |= FLAG_MORE_TO_COME;
   if(exhaustAllowed) flags |= FLAG_EXHAUST_ALLOWED;
 
-  bson::Utils::writeInt32(stream, flags);
+  return flags;
+
+}
+
+void OpMsg::writeToStream(data::stream::ConsistentOutputStream* stream) {
+
+  bson::Utils::writeInt32(stream, getFlags());
 
   for(auto& section : sections) {
     section->writeToStream(stream);
@@ -50,6 +56,16 @@ void OpMsg::writeToStream(data::stream::ConsistentOutputStream* stream) {
 
 }
 
+void OpMsg::writeToSlices(bson::SliceList* slices) {
+
+  bson::Utils::writeInt32(slices->getScratchStream(), getFlags());
+
+  for(auto& section : sections) {
+    section->writeToSlices(slices);
+  }
+
+}
+
 bool OpMsg::readFromCaret(parser::Caret& caret) {
 
   sections.clear();
@@ -113,7 +129,7 @@ bool BodySection::readFromCaret(parser::Caret& caret) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // DocumentSequenceSection
 
-void DocumentSequenceSection::writeToStream(data::stream::ConsistentOutputStream* stream) {
+void DocumentSequenceSection::writeHeader(data::stream::ConsistentOutputStream* stream) {
 
   stream->writeCharSimple(TYPE_DOCUMENT_SEQUENCE);
 
@@ -121,15 +137,42 @@ void DocumentSequenceSection::writeToStream(data::stream::ConsistentOutputStream
   for(auto& doc : documents) {
     size += doc->size();
   }
+  if(documentSlices) {
+    size += documentSlices->getSize();
+  }
   bson::Utils::writeInt32(stream, size);
 
   *stream << identifier;
   stream->writeCharSimple(0);
 
+}
+
+void DocumentSequenceSection::writeToStream(data::stream::ConsistentOutputStream* stream) {
+
+  writeHeader(stream);
+
   for(auto& doc : documents) {
     *stream << doc;
   }
 
+  if(documentSlices) {
+    documentSlices->writeToStream(stream);
+  }
+
+}
+
+void DocumentSequenceSection::writeToSlices(bson::SliceList* slices) {
+
+  writeHeader(slices->getScratchStream());
+
+  for(auto& doc : documents) {
+    slices->append(doc);
+  }
+
+  if(documentSlices) {
+    slices->splice(documentSlices);
+  }
+
 }
 
 bool DocumentSequenceSection::readFromCaret(parser::Caret& caret) {
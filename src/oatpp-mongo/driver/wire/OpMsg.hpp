@@ -26,6 +26,8 @@
 #ifndef oatpp_mongo_driver_wire_OpMsg_hpp
 #define oatpp_mongo_driver_wire_OpMsg_hpp
 
+#include "oatpp-mongo/bson/SliceList.hpp"
+
 #include "oatpp/core/data/stream/Stream.hpp"
 #include "oatpp/core/parser/Caret.hpp"
 #include "oatpp/core/Types.hpp"
@@ -54,6 +56,14 @@ public:
   virtual void writeToStream(data::stream::ConsistentOutputStream* stream) = 0;
   virtual bool readFromCaret(parser::Caret& caret) = 0;
 
+  /**
+   * Write section to &id:oatpp::mongo::bson::SliceList;. By default copies section to the scratch stream.
+   * @param slices
+   */
+  virtual void writeToSlices(bson::SliceList* slices) {
+    writeToStream(slices->getScratchStream());
+  }
+
 };
 
 /**
@@ -78,7 +88,10 @@ public:
 
 public:
 
+  v_int32 getFlags() const;
+
   void writeToStream(data::stream::ConsistentOutputStream* stream);
+  void writeToSlices(bson::SliceList* slices);
   bool readFromCaret(parser::Caret& caret);
 
 };
@@ -98,6 +111,8 @@ public:
 };
 
 struct DocumentSequenceSection : public Section {
+private:
+  void writeHeader(data::stream::ConsistentOutputStream* stream);
 public:
 
   DocumentSequenceSection(const oatpp::String& sectionIdentifier) : Section(TYPE_DOCUMENT_SEQUENCE)
@@ -108,9 +123,15 @@ public:
 
   std::list<oatpp::String> documents;
 
+  /**
+   * Documents encoded as a list of slices. Written after `documents`.
+   */
+  std::shared_ptr<bson::SliceList> documentSlices;
+
 public:
 
   void writeToStream(data::stream::ConsistentOutputStream* stream) override;
+  void writeToSlices(bson::SliceList* slices) override;
 
   bool readFromCaret(parser::Caret& caret) override;
 
@@ -0,0 +1,99 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ArenaTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(String, f1) = "value-1";
+  DTO_FIELD(Int32, f2) = 2;
+  DTO_FIELD(Boolean, f3) = true;
+  DTO_FIELD(Float64, f4) = 4.5;
+  DTO_FIELD(List<Int64>, list) = {1, 2, 3};
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void ArenaTest::onRun() {
+
+  typedef oatpp::mongo::bson::mapping::Deserializer Deserializer;
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+  auto bson = bsonMapper.writeToString(Obj::createShared());
+
+  oatpp::Object<Obj> obj;
+  std::weak_ptr<oatpp::mongo::bson::MonotonicArena> weakArena;
+
+  {
+    OATPP_LOGI(TAG, "read...");
+
+    auto arena = oatpp::mongo::bson::MonotonicArena::createShared();
+    weakArena = arena;
+
+    {
+      Deserializer::ArenaScope arenaScope(arena);
+      obj = bsonMapper.readFromString<oatpp::Object<Obj>>(bson);
+    }
+
+    OATPP_ASSERT(arena->getAllocatedSize() > 0);
+
+    OATPP_ASSERT(obj->f1 == "value-1");
+    OATPP_ASSERT(*obj->f2 == 2);
+    OATPP_ASSERT(*obj->f3 == true);
+    OATPP_ASSERT(*obj->f4 == 4.5);
+    OATPP_ASSERT(obj->list->size() == 3);
+
+    OATPP_LOGI(TAG, "read - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "lifetime...");
+
+    OATPP_ASSERT(!weakArena.expired()); // values keep the arena alive
+    obj = nullptr;
+    OATPP_ASSERT(weakArena.expired());
+
+    OATPP_LOGI(TAG, "lifetime - OK");
+  }
+
+}
+
+}}}}
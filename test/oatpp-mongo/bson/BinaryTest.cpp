@@ -0,0 +1,100 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BinaryTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+#include "oatpp-mongo/bson/Types.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(oatpp::mongo::bson::Binary, f1);
+  DTO_FIELD(oatpp::mongo::bson::Binary, f2);
+  DTO_FIELD(oatpp::mongo::bson::Binary, f3);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void BinaryTest::onRun() {
+
+  typedef oatpp::mongo::bson::type::Binary Binary;
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+  auto obj = Obj::createShared();
+  obj->f1 = Binary(oatpp::String("Hello\0World", 11), Binary::SUBTYPE_USER_DEFINED);
+  obj->f2 = Binary(oatpp::String(""));
+
+  auto bson = bsonMapper.writeToString(obj);
+  OATPP_ASSERT(bsonMapper.computeSize(obj) == (v_buff_size) bson->size());
+
+  {
+    OATPP_LOGI(TAG, "read...");
+    auto result = bsonMapper.readFromString<oatpp::Object<Obj>>(bson);
+
+    OATPP_ASSERT(result->f1);
+    OATPP_ASSERT(result->f1->getSubtype() == Binary::SUBTYPE_USER_DEFINED);
+    OATPP_ASSERT(*result->f1 == *obj->f1);
+
+    OATPP_ASSERT(result->f2);
+    OATPP_ASSERT(result->f2->getSize() == 0);
+    OATPP_ASSERT(result->f2->getSubtype() == Binary::SUBTYPE_GENERIC);
+
+    OATPP_ASSERT(!result->f3);
+
+    OATPP_LOGI(TAG, "read - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "zero-copy...");
+    auto result = bsonMapper.readFromString<oatpp::Object<Obj>>(bson);
+
+    auto begin = bson->data();
+    auto end = begin + bson->size();
+    auto data = (const char*) result->f1->getData();
+
+    OATPP_ASSERT(data >= begin && data + result->f1->getSize() <= end);
+    OATPP_ASSERT(result->f1->getHandle().get() == bson.getPtr().get());
+
+    OATPP_LOGI(TAG, "zero-copy - OK");
+  }
+
+}
+
+}}}}
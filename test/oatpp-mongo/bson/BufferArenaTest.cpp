@@ -0,0 +1,139 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BufferArenaTest.hpp"
+
+#include "oatpp-mongo/bson/BufferArena.hpp"
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+typedef oatpp::mongo::bson::BufferArena BufferArena;
+
+/*
+ * Grow the buffer so that it can be told apart from a freshly allocated one.
+ */
+void grow(const BufferArena::Buffer& buffer, v_buff_size size) {
+  std::string data(size, 'x');
+  buffer->writeSimple(data.data(), size);
+}
+
+}
+
+void BufferArenaTest::onRun() {
+
+  const v_buff_size grownSize = 64 * 1024;
+
+  {
+    OATPP_LOGI(TAG, "reuse released buffer...");
+
+    BufferArena arena;
+
+    oatpp::data::stream::BufferOutputStream* stream;
+    {
+      auto buffer = arena.borrow();
+      grow(buffer, grownSize);
+      stream = buffer.get();
+    }
+
+    auto buffer = arena.borrow();
+    OATPP_ASSERT(buffer.get() == stream);
+    OATPP_ASSERT(buffer->getCurrentPosition() == 0);
+    OATPP_ASSERT(buffer->getCapacity() >= grownSize);
+
+    /* the buffer in use is not handed out twice */
+    auto other = arena.borrow();
+    OATPP_ASSERT(other.get() != stream);
+
+    OATPP_LOGI(TAG, "reuse released buffer - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "free buffers cap...");
+
+    BufferArena arena;
+    const v_int32 count = BufferArena::MAX_FREE_BUFFERS + 2;
+
+    {
+      std::vector<BufferArena::Buffer> buffers;
+      for(v_int32 i = 0; i < count; i ++) {
+        buffers.push_back(arena.borrow());
+        grow(buffers.back(), grownSize);
+      }
+    }
+
+    std::vector<BufferArena::Buffer> buffers;
+    v_int32 reused = 0;
+    for(v_int32 i = 0; i < count; i ++) {
+      buffers.push_back(arena.borrow());
+      if(buffers.back()->getCapacity() >= grownSize) {
+        reused ++;
+      }
+    }
+    OATPP_ASSERT(reused == BufferArena::MAX_FREE_BUFFERS);
+
+    OATPP_LOGI(TAG, "free buffers cap - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "drop oversized buffer...");
+
+    BufferArena arena;
+
+    {
+      auto buffer = arena.borrow();
+      grow(buffer, BufferArena::MAX_BUFFER_CAPACITY + 1);
+      OATPP_ASSERT(buffer->getCapacity() > BufferArena::MAX_BUFFER_CAPACITY);
+    }
+
+    auto buffer = arena.borrow();
+    OATPP_ASSERT(buffer->getCapacity() <= BufferArena::MAX_BUFFER_CAPACITY);
+    OATPP_ASSERT(buffer->getCurrentPosition() == 0);
+
+    OATPP_LOGI(TAG, "drop oversized buffer - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "pooled writeToString...");
+
+    oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+    oatpp::Fields<oatpp::String> large = {{"key", oatpp::String(std::string(grownSize, 'x'))}};
+    oatpp::Fields<oatpp::String> small = {{"key", "value"}};
+
+    /* the scratch buffer grown by the large document must not leak into the small one */
+    OATPP_ASSERT(bsonMapper.writeToStringPooled(large) == bsonMapper.writeToString(large));
+    OATPP_ASSERT(bsonMapper.writeToStringPooled(small) == bsonMapper.writeToString(small));
+
+    OATPP_LOGI(TAG, "pooled writeToString - OK");
+  }
+
+}
+
+}}}}
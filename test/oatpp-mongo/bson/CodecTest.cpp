@@ -0,0 +1,189 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "CodecTest.hpp"
+
+#include "oatpp-mongo/bson/Codec.hpp"
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+/* Wide flat object */
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(oatpp::mongo::bson::ObjectId, id, "_id");
+  DTO_FIELD(Int8, i8) = 8;
+  DTO_FIELD(UInt8, u8) = 8;
+  DTO_FIELD(Int16, i16) = -16;
+  DTO_FIELD(UInt16, u16) = 16;
+  DTO_FIELD(Int32, i32) = -32;
+  DTO_FIELD(UInt32, u32) = 32;
+  DTO_FIELD(Int64, i64) = -64;
+  DTO_FIELD(UInt64, u64) = 64;
+  DTO_FIELD(Float32, f32) = 32.5;
+  DTO_FIELD(Float64, f64) = 64.25;
+  DTO_FIELD(Boolean, b) = true;
+  DTO_FIELD(String, s1) = "Hello";
+  DTO_FIELD(String, s2) = "World";
+  DTO_FIELD(String, s3) = nullptr;
+  DTO_FIELD(oatpp::mongo::bson::DateTime, time) = 1600000000000;
+
+};
+
+/* Fields in different order */
+class Sub1 : public oatpp::DTO {
+
+  DTO_INIT(Sub1, DTO)
+
+  DTO_FIELD(String, s2);
+  DTO_FIELD(Int32, i32);
+  DTO_FIELD(String, s3) = "not null";
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#define OBJ_FIELD(NAME) OATPP_MONGO_BSON_CODEC_FIELD(Obj, NAME)
+
+typedef oatpp::mongo::bson::Codec<Obj,
+  OBJ_FIELD(id), OBJ_FIELD(i8), OBJ_FIELD(u8), OBJ_FIELD(i16), OBJ_FIELD(u16), OBJ_FIELD(i32), OBJ_FIELD(u32),
+  OBJ_FIELD(i64), OBJ_FIELD(u64), OBJ_FIELD(f32), OBJ_FIELD(f64), OBJ_FIELD(b), OBJ_FIELD(s1), OBJ_FIELD(s2),
+  OBJ_FIELD(s3), OBJ_FIELD(time)
+> ObjCodec;
+
+typedef oatpp::mongo::bson::Codec<Sub1,
+  OATPP_MONGO_BSON_CODEC_FIELD(Sub1, s2),
+  OATPP_MONGO_BSON_CODEC_FIELD(Sub1, i32),
+  OATPP_MONGO_BSON_CODEC_FIELD(Sub1, s3)
+> Sub1Codec;
+
+typedef oatpp::mongo::bson::Codec<Sub1,
+  OATPP_MONGO_BSON_CODEC_FIELD(Sub1, i32),
+  OATPP_MONGO_BSON_CODEC_FIELD(Sub1, s2),
+  OATPP_MONGO_BSON_CODEC_FIELD(Sub1, s3)
+> Sub1WrongOrderCodec;
+
+#undef OBJ_FIELD
+
+}
+
+void CodecTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+  auto obj = Obj::createShared();
+  obj->id = oatpp::mongo::bson::type::ObjectId();
+
+  auto bson = bsonMapper.writeToString(obj);
+
+  {
+    OATPP_LOGI(TAG, "encode...");
+    auto encoded = ObjCodec::encodeToString(obj);
+    OATPP_ASSERT(encoded == bson);
+    OATPP_LOGI(TAG, "encode - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "decode...");
+    auto decoded = ObjCodec::decodeFromString(bson);
+    OATPP_ASSERT(bsonMapper.writeToString(decoded) == bson);
+
+    auto sub = Sub1Codec::decodeFromString(bson);
+    OATPP_ASSERT(sub->s2 == obj->s2);
+    OATPP_ASSERT(sub->i32 == obj->i32);
+    OATPP_ASSERT(!sub->s3);
+    OATPP_LOGI(TAG, "decode - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "fields order...");
+    bool failed = false;
+    try {
+      Sub1WrongOrderCodec::encodeToString(Sub1::createShared());
+    } catch (const std::runtime_error&) {
+      failed = true;
+    }
+    OATPP_ASSERT(failed);
+    OATPP_LOGI(TAG, "fields order - OK");
+  }
+
+#ifdef OATPP_BUILD_BENCHMARKS
+  /* Enabled with -DOATPP_BUILD_BENCHMARKS=ON */
+  {
+    const v_int32 iterations = 100000;
+
+    OATPP_LOGI(TAG, "Benchmark: %d iterations of wide flat object (%d bytes)", iterations, (v_int32) bson->size());
+
+    data::stream::BufferOutputStream stream(bson->size());
+
+    {
+      oatpp::test::PerformanceChecker checker("ObjectMapper::write");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        stream.setCurrentPosition(0);
+        bsonMapper.write(&stream, obj);
+      }
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("Codec::encode");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        stream.setCurrentPosition(0);
+        ObjCodec::encode(&stream, obj);
+      }
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("ObjectMapper::read");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        oatpp::parser::Caret caret(bson);
+        bsonMapper.read(caret, oatpp::Object<Obj>::Class::getType());
+      }
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("Codec::decode");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        oatpp::parser::Caret caret(bson);
+        ObjCodec::decode(caret);
+      }
+    }
+
+  }
+#endif
+
+}
+
+}}}}
@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Decimal128Test.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+#include "oatpp-mongo/bson/Types.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(oatpp::mongo::bson::Decimal128, f1);
+  DTO_FIELD(oatpp::mongo::bson::Decimal128, f2);
+  DTO_FIELD(oatpp::mongo::bson::Decimal128, f3);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void Decimal128Test::onRun() {
+
+  typedef oatpp::mongo::bson::type::Decimal128 Decimal128;
+
+  {
+    OATPP_LOGI(TAG, "encoding...");
+
+    OATPP_ASSERT(Decimal128::fromString("0.1") == Decimal128(0x303E000000000000, 0x0000000000000001));
+    OATPP_ASSERT(Decimal128::fromString("-1") == Decimal128(0xB040000000000000, 0x0000000000000001));
+    OATPP_ASSERT(Decimal128::fromString("1234567890123456789012345678901234") == Decimal128(0x30403CDE6FFF9732, 0xDE825CD07E96AFF2));
+    OATPP_ASSERT(Decimal128::fromString("Infinity").isInfinite());
+    OATPP_ASSERT(Decimal128::fromString("NaN").isNaN());
+
+    OATPP_LOGI(TAG, "encoding - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "strings...");
+
+    const char* const values[] = {
+      "0", "-0", "0.000", "1", "-1", "0.1", "123.456", "0.000001", "1E-7", "1E+3", "1.23E-10",
+      "1234567890123456789012345678901234", "9.999999999999999999999999999999999E+6144", "1E-6176",
+      "Infinity", "-Infinity", "NaN"
+    };
+
+    for(const char* value : values) {
+      auto str = Decimal128::fromString(value).toString();
+      OATPP_ASSERT(str == value);
+    }
+
+    OATPP_ASSERT(Decimal128::fromString("0.0000001").toString() == "1E-7");
+    OATPP_ASSERT(Decimal128::fromString("12345678901234567890123456789012345").toString() == "1.234567890123456789012345678901234E+34");
+    OATPP_ASSERT(Decimal128::fromString("99999999999999999999999999999999995").toString() == "1.000000000000000000000000000000000E+35");
+
+    OATPP_LOGI(TAG, "strings - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "doubles...");
+
+    OATPP_ASSERT(Decimal128::fromDouble(0.1).toString() == "0.1");
+    OATPP_ASSERT(Decimal128::fromDouble(100.0).toString() == "100");
+    OATPP_ASSERT(Decimal128::fromDouble(-2.5).toString() == "-2.5");
+
+    OATPP_ASSERT(Decimal128::fromString("0.1").toDouble() == 0.1);
+    OATPP_ASSERT(Decimal128::fromString("1234.5678").toDouble() == 1234.5678);
+    OATPP_ASSERT(Decimal128::fromString("1.5E+300").toDouble() == 1.5e300);
+
+    OATPP_LOGI(TAG, "doubles - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "mapping...");
+
+    oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+    auto obj = Obj::createShared();
+    obj->f1 = Decimal128::fromString("12345.67");
+    obj->f2 = Decimal128::fromString("-0.000001");
+
+    auto bson = bsonMapper.writeToString(obj);
+    OATPP_ASSERT(bsonMapper.computeSize(obj) == (v_buff_size) bson->size());
+
+    auto result = bsonMapper.readFromString<oatpp::Object<Obj>>(bson);
+
+    OATPP_ASSERT(result->f1 && *result->f1 == *obj->f1);
+    OATPP_ASSERT(result->f2 && *result->f2 == *obj->f2);
+    OATPP_ASSERT(!result->f3);
+
+    OATPP_LOGI(TAG, "mapping - OK");
+  }
+
+}
+
+}}}}
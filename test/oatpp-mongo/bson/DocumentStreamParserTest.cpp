@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentStreamParserTest.hpp"
+
+#include "oatpp-mongo/bson/DocumentStreamParser.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(Int32, index);
+  DTO_FIELD(String, value) = "value";
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void DocumentStreamParserTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+  std::string stream;
+  for(v_int32 i = 0; i < 3; i ++) {
+    auto obj = Obj::createShared();
+    obj->index = i;
+    stream += *bsonMapper.writeToString(obj);
+  }
+
+  for(v_buff_size chunkSize : {1, 3, 7, 1000}) {
+
+    OATPP_LOGI(TAG, "chunk size %d...", (v_int32) chunkSize);
+
+    oatpp::mongo::bson::DocumentStreamParser parser;
+    v_int32 expectedIndex = 0;
+
+    for(v_buff_size position = 0; position < (v_buff_size) stream.size(); position += chunkSize) {
+      v_buff_size size = std::min<v_buff_size>(chunkSize, stream.size() - position);
+      OATPP_ASSERT(parser.feed(stream.data() + position, size) == size);
+      while(auto obj = parser.nextObject<oatpp::Object<Obj>>(bsonMapper)) {
+        OATPP_ASSERT(*obj->index == expectedIndex);
+        OATPP_ASSERT(obj->value == "value");
+        expectedIndex ++;
+      }
+    }
+
+    OATPP_ASSERT(expectedIndex == 3);
+    OATPP_ASSERT(parser.isAtBoundary());
+    OATPP_ASSERT(!parser.hasError());
+
+    OATPP_LOGI(TAG, "chunk size %d - OK", (v_int32) chunkSize);
+
+  }
+
+  {
+    OATPP_LOGI(TAG, "invalid stream...");
+
+    oatpp::mongo::bson::DocumentStreamParser parser(16);
+    OATPP_ASSERT(parser.feed(stream.data(), stream.size()) < (v_buff_size) stream.size()); // document is larger than 16 bytes
+    OATPP_ASSERT(parser.hasError());
+    OATPP_ASSERT(parser.nextDocument() == nullptr);
+
+    OATPP_LOGI(TAG, "invalid stream - OK");
+  }
+
+}
+
+}}}}
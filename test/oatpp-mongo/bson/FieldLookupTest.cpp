@@ -0,0 +1,148 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "FieldLookupTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+/*
+ * Target DTO. Names of the same size are ordered by bytes when searched.
+ */
+class Target : public oatpp::DTO {
+
+  DTO_INIT(Target, DTO)
+
+  DTO_FIELD(String, ccc);
+  DTO_FIELD(String, aaa);
+  DTO_FIELD(String, b);
+  DTO_FIELD(String, eeeee);
+  DTO_FIELD(String, bbb);
+
+};
+
+/*
+ * Same fields in reverse order.
+ */
+class Reversed : public oatpp::DTO {
+
+  DTO_INIT(Reversed, DTO)
+
+  DTO_FIELD(String, bbb) = "bbb-value";
+  DTO_FIELD(String, eeeee) = "eeeee-value";
+  DTO_FIELD(String, b) = "b-value";
+  DTO_FIELD(String, aaa) = "aaa-value";
+  DTO_FIELD(String, ccc) = "ccc-value";
+
+};
+
+/*
+ * Unknown keys of the same size as known ones, sorting before, between and after them.
+ */
+class WithUnknown : public oatpp::DTO {
+
+  DTO_INIT(WithUnknown, DTO)
+
+  DTO_FIELD(String, aab) = "unknown-1";
+  DTO_FIELD(String, ccc) = "ccc-value";
+  DTO_FIELD(String, bba) = "unknown-2";
+  DTO_FIELD(String, a) = "unknown-3";
+  DTO_FIELD(String, aaa) = "aaa-value";
+  DTO_FIELD(String, zzz) = "unknown-4";
+  DTO_FIELD(String, bbb) = "bbb-value";
+  DTO_FIELD(String, eeeef) = "unknown-5";
+  DTO_FIELD(String, longUnknownKey) = "unknown-6";
+  DTO_FIELD(String, b) = "b-value";
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void FieldLookupTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+  {
+    OATPP_LOGI(TAG, "out-of-order keys...");
+
+    auto obj = bsonMapper.readFromString<oatpp::Object<Target>>(bsonMapper.writeToString(Reversed::createShared()));
+    OATPP_ASSERT(obj);
+    OATPP_ASSERT(obj->aaa == "aaa-value");
+    OATPP_ASSERT(obj->b == "b-value");
+    OATPP_ASSERT(obj->bbb == "bbb-value");
+    OATPP_ASSERT(obj->ccc == "ccc-value");
+    OATPP_ASSERT(obj->eeeee == "eeeee-value");
+
+    OATPP_LOGI(TAG, "out-of-order keys - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "unknown keys...");
+
+    auto obj = bsonMapper.readFromString<oatpp::Object<Target>>(bsonMapper.writeToString(WithUnknown::createShared()));
+    OATPP_ASSERT(obj);
+    OATPP_ASSERT(obj->aaa == "aaa-value");
+    OATPP_ASSERT(obj->b == "b-value");
+    OATPP_ASSERT(obj->bbb == "bbb-value");
+    OATPP_ASSERT(obj->ccc == "ccc-value");
+    OATPP_ASSERT(obj->eeeee == nullptr);
+
+    OATPP_LOGI(TAG, "unknown keys - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "unknown keys not allowed...");
+
+    oatpp::mongo::bson::mapping::ObjectMapper strictMapper;
+    strictMapper.getDeserializer()->getConfig()->allowUnknownFields = false;
+
+    auto obj = strictMapper.readFromString<oatpp::Object<Target>>(bsonMapper.writeToString(Reversed::createShared()));
+    OATPP_ASSERT(obj);
+    OATPP_ASSERT(obj->aaa == "aaa-value");
+
+    bool thrown = false;
+    try {
+      strictMapper.readFromString<oatpp::Object<Target>>(bsonMapper.writeToString(WithUnknown::createShared()));
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_LOGI(TAG, "unknown keys not allowed - OK");
+  }
+
+}
+
+}}}}
@@ -0,0 +1,285 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "InterpretationTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/LazyDocument.hpp"
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+struct VPoint {
+  v_int32 x;
+  v_int32 y;
+};
+
+namespace __class {
+  class PointClass;
+  class PointXClass;
+}
+
+typedef oatpp::data::mapping::type::Primitive<VPoint, __class::PointClass> Point;
+typedef oatpp::data::mapping::type::Primitive<VPoint, __class::PointXClass> PointX;
+
+namespace __class {
+
+  /*
+   * Point is interpreted either as String "x,y" or as Int32 x.
+   */
+  class PointClass {
+  private:
+
+    class AsString : public oatpp::data::mapping::type::Type::Interpretation<Point, oatpp::String> {
+    public:
+
+      oatpp::String interpret(const Point& value) const override {
+        return std::to_string(value->x) + "," + std::to_string(value->y);
+      }
+
+      Point reproduce(const oatpp::String& value) const override {
+        auto separator = value->find(',');
+        return Point(VPoint{std::stoi(value->substr(0, separator)), std::stoi(value->substr(separator + 1))});
+      }
+
+    };
+
+    class AsX : public oatpp::data::mapping::type::Type::Interpretation<Point, oatpp::Int32> {
+    public:
+
+      oatpp::Int32 interpret(const Point& value) const override {
+        return value->x;
+      }
+
+      Point reproduce(const oatpp::Int32& value) const override {
+        return Point(VPoint{*value, 0});
+      }
+
+    };
+
+  public:
+
+    static const oatpp::data::mapping::type::ClassId CLASS_ID;
+
+    static oatpp::data::mapping::type::Type* getType() {
+      static oatpp::data::mapping::type::Type type(CLASS_ID, createInfo());
+      return &type;
+    }
+
+  private:
+
+    static oatpp::data::mapping::type::Type::Info createInfo() {
+      oatpp::data::mapping::type::Type::Info info;
+      info.interpretationMap = {
+        {"as-string", new AsString()},
+        {"as-x", new AsX()}
+      };
+      return info;
+    }
+
+  };
+
+  const oatpp::data::mapping::type::ClassId PointClass::CLASS_ID("test::bson::Point");
+
+  /*
+   * Different type with the same ClassId as Point - "as-string" is interpreted as Int32 x.
+   */
+  class PointXClass {
+  private:
+
+    class AsX : public oatpp::data::mapping::type::Type::Interpretation<PointX, oatpp::Int32> {
+    public:
+
+      oatpp::Int32 interpret(const PointX& value) const override {
+        return value->x;
+      }
+
+      PointX reproduce(const oatpp::Int32& value) const override {
+        return PointX(VPoint{*value, 0});
+      }
+
+    };
+
+  public:
+
+    static oatpp::data::mapping::type::Type* getType() {
+      static oatpp::data::mapping::type::Type type(PointClass::CLASS_ID, createInfo());
+      return &type;
+    }
+
+  private:
+
+    static oatpp::data::mapping::type::Type::Info createInfo() {
+      oatpp::data::mapping::type::Type::Info info;
+      info.interpretationMap = {
+        {"as-string", new AsX()}
+      };
+      return info;
+    }
+
+  };
+
+}
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class PointDto : public oatpp::DTO {
+
+  DTO_INIT(PointDto, DTO)
+
+  DTO_FIELD(Point, point);
+
+};
+
+class PointXDto : public oatpp::DTO {
+
+  DTO_INIT(PointXDto, DTO)
+
+  DTO_FIELD(PointX, point);
+
+};
+
+class StringDto : public oatpp::DTO {
+
+  DTO_INIT(StringDto, DTO)
+
+  DTO_FIELD(String, point);
+
+};
+
+class IntDto : public oatpp::DTO {
+
+  DTO_INIT(IntDto, DTO)
+
+  DTO_FIELD(Int32, point);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void InterpretationTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+  auto serializerConfig = bsonMapper.getSerializer()->getConfig();
+  auto deserializerConfig = bsonMapper.getDeserializer()->getConfig();
+
+  auto obj = PointDto::createShared();
+  obj->point = Point(VPoint{1, 2});
+
+  {
+    OATPP_LOGI(TAG, "serialize with changing interpretations...");
+
+    serializerConfig->enableInterpretations = {"as-string"};
+    auto asString = bsonMapper.readFromString<oatpp::Object<StringDto>>(bsonMapper.writeToString(obj));
+    OATPP_ASSERT(asString->point == "1,2");
+
+    serializerConfig->enableInterpretations = {"as-x"};
+    auto asX = bsonMapper.readFromString<oatpp::Object<IntDto>>(bsonMapper.writeToString(obj));
+    OATPP_ASSERT(*asX->point == 1);
+
+    serializerConfig->enableInterpretations = {};
+    bool thrown = false;
+    try {
+      bsonMapper.writeToString(obj);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_LOGI(TAG, "serialize with changing interpretations - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "serialize types sharing ClassId...");
+
+    auto objX = PointXDto::createShared();
+    objX->point = PointX(VPoint{7, 8});
+
+    serializerConfig->enableInterpretations = {"as-string"};
+    for(v_int32 i = 0; i < 2; i ++) {
+      auto asString = bsonMapper.readFromString<oatpp::Object<StringDto>>(bsonMapper.writeToString(obj));
+      OATPP_ASSERT(asString->point == "1,2");
+      auto asX = bsonMapper.readFromString<oatpp::Object<IntDto>>(bsonMapper.writeToString(objX));
+      OATPP_ASSERT(*asX->point == 7);
+    }
+
+    OATPP_LOGI(TAG, "serialize types sharing ClassId - OK");
+  }
+
+  auto stringDto = StringDto::createShared();
+  stringDto->point = "3,4";
+  auto stringBson = bsonMapper.writeToString(stringDto);
+
+  auto intDto = IntDto::createShared();
+  intDto->point = 5;
+  auto intBson = bsonMapper.writeToString(intDto);
+
+  {
+    OATPP_LOGI(TAG, "deserialize with changing interpretations...");
+
+    deserializerConfig->enableInterpretations = {"as-string"};
+    auto fromString = bsonMapper.readFromString<oatpp::Object<PointDto>>(stringBson);
+    OATPP_ASSERT(fromString->point->x == 3);
+    OATPP_ASSERT(fromString->point->y == 4);
+
+    deserializerConfig->enableInterpretations = {"as-x"};
+    auto fromInt = bsonMapper.readFromString<oatpp::Object<PointDto>>(intBson);
+    OATPP_ASSERT(fromInt->point->x == 5);
+    OATPP_ASSERT(fromInt->point->y == 0);
+
+    OATPP_LOGI(TAG, "deserialize with changing interpretations - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "deserialize element without root document...");
+
+    /* LazyDocument deserializes field values directly - no root document is deserialized before */
+    oatpp::mongo::bson::mapping::Deserializer::Config config;
+    config.enableInterpretations = {"as-string"};
+    auto deserializer = std::make_shared<oatpp::mongo::bson::mapping::Deserializer>(
+      std::make_shared<oatpp::mongo::bson::mapping::Deserializer::Config>(config)
+    );
+
+    oatpp::mongo::bson::mapping::LazyDocument lazy(oatpp::mongo::bson::InlineDocument(stringBson.getPtr()), deserializer);
+    auto point = lazy.get<Point>("point");
+    OATPP_ASSERT(point->x == 3);
+    OATPP_ASSERT(point->y == 4);
+
+    deserializer->getConfig()->enableInterpretations = {"as-x"};
+    oatpp::mongo::bson::mapping::LazyDocument lazyInt(oatpp::mongo::bson::InlineDocument(intBson.getPtr()), deserializer);
+    OATPP_ASSERT(lazyInt.get<Point>("point")->x == 5);
+
+    OATPP_LOGI(TAG, "deserialize element without root document - OK");
+  }
+
+}
+
+}}}}
@@ -0,0 +1,114 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "LazyDocumentTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/LazyDocument.hpp"
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Nested : public oatpp::DTO {
+
+  DTO_INIT(Nested, DTO)
+
+  DTO_FIELD(String, f1) = "nested-1";
+
+};
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(String, f1) = "value-1";
+  DTO_FIELD(Int32, f2) = 2;
+  DTO_FIELD(Object<Nested>, nested) = Nested::createShared();
+  DTO_FIELD(List<Int32>, list) = {1, 2, 3};
+  DTO_FIELD(String, f3) = "value-3";
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void LazyDocumentTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+  auto bson = bsonMapper.writeToString(Obj::createShared());
+  oatpp::mongo::bson::InlineDocument document(bson.getPtr());
+
+  {
+    OATPP_LOGI(TAG, "fields...");
+
+    oatpp::mongo::bson::mapping::LazyDocument lazy(document, bsonMapper.getDeserializer());
+
+    auto f3 = lazy.get<oatpp::String>("f3");
+    OATPP_ASSERT(f3 == "value-3");
+    OATPP_ASSERT(lazy.get<oatpp::String>("f3").get() == f3.get()); // cached
+
+    OATPP_ASSERT(*lazy.get<oatpp::Int32>("f2") == 2);
+
+    auto nested = lazy.get<oatpp::Object<Nested>>("nested");
+    OATPP_ASSERT(nested && nested->f1 == "nested-1");
+
+    auto list = lazy.get<oatpp::List<oatpp::Int32>>("list");
+    OATPP_ASSERT(list && list->size() == 3 && *list[2] == 3);
+
+    OATPP_ASSERT(lazy.hasField("f1"));
+    OATPP_ASSERT(!lazy.hasField("unknown"));
+    OATPP_ASSERT(lazy.get<oatpp::String>("unknown") == nullptr);
+
+    OATPP_LOGI(TAG, "fields - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "invalid document...");
+
+    oatpp::mongo::bson::InlineDocument invalid(std::make_shared<std::string>(bson->substr(0, bson->size() - 8)));
+    oatpp::mongo::bson::mapping::LazyDocument lazy(invalid, bsonMapper.getDeserializer());
+
+    bool thrown = false;
+    try {
+      lazy.get<oatpp::String>("f3");
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_LOGI(TAG, "invalid document - OK");
+  }
+
+}
+
+}}}}
@@ -27,6 +27,7 @@
 
 #include "oatpp-mongo/TestUtils.hpp"
 #include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+#include "oatpp-mongo/bson/Utils.hpp"
 
 #include "oatpp/core/Types.hpp"
 #include "oatpp/core/macro/codegen.hpp"
@@ -163,6 +164,7 @@ void ListTest::onRun() {
     }
 
     OATPP_ASSERT(bson == bcxx);
+    OATPP_ASSERT(bsonMapper.computeSize(obj) == bson->size());
 
 
     {
@@ -312,6 +314,121 @@ void ListTest::onRun() {
     OATPP_LOGI(TAG, "OK");
   }
 
+  {
+    OATPP_LOGI(TAG, "Large array (index keys out of the precomputed range)...");
+
+    const v_int32 count = oatpp::mongo::bson::Utils::ARRAY_INDEX_KEYS_COUNT + 1000;
+
+    auto vector = oatpp::Vector<oatpp::Int32>::createShared();
+    vector->reserve(count);
+    for(v_int32 i = 0; i < count; i ++) {
+      vector->push_back(i);
+    }
+
+    auto bson = bsonMapper.writeToString(vector);
+    OATPP_ASSERT(bsonMapper.computeSize(vector) == bson->size());
+
+    auto parallelConfig = oatpp::mongo::bson::mapping::Serializer::Config::createShared();
+    parallelConfig->parallelCollectionThreshold = 1000;
+    parallelConfig->parallelCollectionThreads = 4;
+    oatpp::mongo::bson::mapping::ObjectMapper parallelMapper(
+      parallelConfig, oatpp::mongo::bson::mapping::Deserializer::Config::createShared()
+    );
+    OATPP_ASSERT(parallelMapper.writeToString(vector) == bson);
+
+    /* Large collections nested in ranges of a large collection - run on the same bounded pool */
+    auto nested = oatpp::Vector<oatpp::Vector<oatpp::Int32>>::createShared();
+    for(v_int32 i = 0; i < 2048; i ++) {
+      nested->push_back(i % 512 == 0 ? vector : oatpp::Vector<oatpp::Int32>({i}));
+    }
+    OATPP_ASSERT(parallelMapper.writeToString(nested) == bsonMapper.writeToString(nested));
+
+    /* Large strings of every range are referenced in place when serializing to SliceList */
+    auto strings = oatpp::Vector<oatpp::String>::createShared();
+    for(v_int32 i = 0; i < 4096; i ++) {
+      strings->push_back(oatpp::String(std::string(i % 1024 == 1023 ? 256 : 8, (char) ('a' + i % 26))));
+    }
+    parallelConfig->referenceThreshold = 128;
+    oatpp::mongo::bson::SliceList slices;
+    parallelMapper.writeToSlices(&slices, strings);
+    OATPP_ASSERT(slices.toString() == bsonMapper.writeToString(strings));
+
+    v_int32 referenced = 0;
+    for(auto& slice : slices.getSlices()) {
+      for(auto& str : *strings) {
+        if(slice.data == str->data()) {
+          referenced ++;
+        }
+      }
+    }
+    OATPP_ASSERT(referenced == 4);
+
+    auto c = bsonMapper.readFromString<oatpp::Vector<oatpp::Int32>>(bson);
+    OATPP_ASSERT(c);
+    OATPP_ASSERT(c->size() == count);
+    for(v_int32 i = 0; i < count; i ++) {
+      OATPP_ASSERT(c[i] == vector[i]);
+    }
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+
+  {
+    OATPP_LOGI(TAG, "Array index keys...");
+
+    /* BSON arrays are documents with keys "0", "1", ... - write documents with other keys */
+    auto writeKeys = [&bsonMapper](const std::vector<const char*>& keys) {
+      auto fields = oatpp::Fields<oatpp::Int32>::createShared();
+      for(v_int32 i = 0; i < (v_int32) keys.size(); i ++) {
+        fields->push_back({keys[i], i});
+      }
+      return bsonMapper.writeToString(fields);
+    };
+
+    auto valid = writeKeys({"0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11"});
+    auto outOfOrder = writeKeys({"0", "2", "1"});
+    auto nonNumeric = writeKeys({"0", "x", "2"});
+    auto leadingZero = writeKeys({"0", "01", "2"});
+    auto notFromZero = writeKeys({"1", "2", "3"});
+
+    const oatpp::data::mapping::type::Type* vectorType = oatpp::Vector<oatpp::Int32>::Class::getType();
+
+    {
+      oatpp::parser::Caret caret(valid);
+      auto c = bsonMapper.read(caret, vectorType).cast<oatpp::Vector<oatpp::Int32>>();
+      OATPP_ASSERT(!caret.hasError());
+      OATPP_ASSERT(c->size() == 12);
+      OATPP_ASSERT(c[11] == 11);
+    }
+
+    for(auto& bson : {outOfOrder, nonNumeric, leadingZero, notFromZero}) {
+      oatpp::parser::Caret caret(bson);
+      auto c = bsonMapper.read(caret, vectorType);
+      OATPP_ASSERT(caret.hasError());
+      OATPP_ASSERT(c == nullptr);
+    }
+
+    auto trustedConfig = oatpp::mongo::bson::mapping::Deserializer::Config::createShared();
+    trustedConfig->validateArrayIndices = false;
+    oatpp::mongo::bson::mapping::ObjectMapper trustedMapper(
+      oatpp::mongo::bson::mapping::Serializer::Config::createShared(), trustedConfig
+    );
+
+    /* keys are skipped - elements are taken in document order */
+    for(auto& bson : {valid, outOfOrder, nonNumeric, leadingZero, notFromZero}) {
+      oatpp::parser::Caret caret(bson);
+      auto c = trustedMapper.read(caret, vectorType).cast<oatpp::Vector<oatpp::Int32>>();
+      OATPP_ASSERT(!caret.hasError());
+      OATPP_ASSERT(c);
+      for(v_int32 i = 0; i < (v_int32) c->size(); i ++) {
+        OATPP_ASSERT(c[i] == i);
+      }
+    }
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
 }
 
 }}}}
\ No newline at end of file
@@ -180,6 +180,23 @@ class PolymorphicDto : public oatpp::DTO {
 
 };
 
+/* Type selector field goes after the polymorphic field - decoding of the payload is deferred */
+class PayloadFirstDto : public oatpp::DTO {
+
+  DTO_INIT(PayloadFirstDto, DTO)
+
+  DTO_FIELD(Any, polymorph);
+  DTO_FIELD(String, type);
+
+  DTO_FIELD_TYPE_SELECTOR(polymorph) {
+    if(type == "str") return String::Class::getType();
+    if(type == "int") return Int32::Class::getType();
+    if(type == "obj") return oatpp::Object<Nested1>::Class::getType();
+    return Void::Class::getType();
+  }
+
+};
+
 #include OATPP_CODEGEN_END(DTO)
 
 }
@@ -289,6 +306,65 @@ void ObjectTest::onRun() {
     OATPP_LOGI(TAG, "OK");
   }
 
+
+  {
+    OATPP_LOGI(TAG, "Test Polymorphic field before type selector...");
+
+    oatpp::mongo::bson::mapping::ObjectMapper mapper;
+
+    auto dto = PayloadFirstDto::createShared();
+    dto->type = "int";
+    dto->polymorph = oatpp::Int32(42);
+
+    auto dtoClone = mapper.readFromString<oatpp::Object<PayloadFirstDto>>(mapper.writeToString(dto));
+    OATPP_ASSERT(dtoClone->type == "int")
+    OATPP_ASSERT(dtoClone->polymorph.getStoredType() == oatpp::Int32::Class::getType())
+    OATPP_ASSERT(dtoClone->polymorph.retrieve<oatpp::Int32>() == 42)
+
+    auto nested = Nested1::createShared();
+    nested->f1 = "nested";
+    dto->type = "obj";
+    dto->polymorph = nested;
+
+    dtoClone = mapper.readFromString<oatpp::Object<PayloadFirstDto>>(mapper.writeToString(dto));
+    OATPP_ASSERT(dtoClone->polymorph.getStoredType() == oatpp::Object<Nested1>::Class::getType())
+    OATPP_ASSERT(Nested1::cmp(dtoClone->polymorph.retrieve<oatpp::Object<Nested1>>(), nested))
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test malformed deferred polymorphic payload...");
+
+    oatpp::mongo::bson::mapping::ObjectMapper mapper;
+    const oatpp::data::mapping::type::Type* dtoType = oatpp::Object<PayloadFirstDto>::Class::getType();
+
+    /* payload doesn't match the selected type */
+    auto dto = PayloadFirstDto::createShared();
+    dto->type = "obj";
+    dto->polymorph = oatpp::String("not an object");
+
+    auto bson = mapper.writeToString(dto);
+    oatpp::parser::Caret mismatchCaret(bson);
+    OATPP_ASSERT(mapper.read(mismatchCaret, dtoType) == nullptr)
+    OATPP_ASSERT(mismatchCaret.hasError())
+
+    /* payload document is skipped by its size, but a string inside it overruns the document */
+    auto nested = Nested1::createShared();
+    dto->polymorph = nested;
+
+    std::string corrupted = *mapper.writeToString(dto);
+    auto helloPos = corrupted.find("Hello");
+    OATPP_ASSERT(helloPos != std::string::npos)
+    corrupted[helloPos - 4] = 100; // string size prefix
+
+    oatpp::parser::Caret corruptedCaret(corrupted.data(), corrupted.size());
+    OATPP_ASSERT(mapper.read(corruptedCaret, dtoType) == nullptr)
+    OATPP_ASSERT(corruptedCaret.hasError())
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
 }
 
 }}}}
\ No newline at end of file
@@ -0,0 +1,174 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PlanCacheTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+#include "oatpp-mongo/bson/mapping/PlanCache.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Nested : public oatpp::DTO {
+
+  DTO_INIT(Nested, DTO)
+
+  DTO_FIELD(String, name) = "nested";
+
+};
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(String, name) = "obj";
+  DTO_FIELD(Object<Nested>, nested) = Nested::createShared();
+
+};
+
+class NestedInt : public oatpp::DTO {
+
+  DTO_INIT(NestedInt, DTO)
+
+  DTO_FIELD(Int32, name);
+
+};
+
+class ObjInt : public oatpp::DTO {
+
+  DTO_INIT(ObjInt, DTO)
+
+  DTO_FIELD(Int32, name);
+  DTO_FIELD(Object<NestedInt>, nested);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+/*
+ * Writes every string as INT_32 holding the string length.
+ */
+void serializeStringLength(oatpp::mongo::bson::mapping::Serializer* serializer,
+                           oatpp::data::stream::ConsistentOutputStream* stream,
+                           const oatpp::data::share::StringKeyLabel& key,
+                           const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  auto str = static_cast<std::string*>(polymorph.get());
+  oatpp::mongo::bson::Utils::writeKey(stream, oatpp::mongo::bson::TypeCode::INT_32, key);
+  oatpp::mongo::bson::Utils::writeInt32(stream, (v_int32) str->size());
+}
+
+}
+
+void PlanCacheTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+
+  {
+    OATPP_LOGI(TAG, "concurrent serialization...");
+
+    auto expected = bsonMapper.writeToString(Obj::createShared());
+
+    std::vector<oatpp::String> results(8);
+    std::vector<std::thread> threads;
+    for(size_t i = 0; i < results.size(); i ++) {
+      threads.push_back(std::thread([&bsonMapper, &results, i] {
+        for(v_int32 j = 0; j < 100; j ++) {
+          results[i] = bsonMapper.writeToString(Obj::createShared());
+        }
+      }));
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+
+    for(auto& result : results) {
+      OATPP_ASSERT(result == expected);
+    }
+
+    OATPP_LOGI(TAG, "concurrent serialization - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "plan rebuild after setSerializerMethod...");
+
+    auto before = bsonMapper.readFromString<oatpp::Object<Obj>>(bsonMapper.writeToString(Obj::createShared()));
+    OATPP_ASSERT(before->name == "obj");
+    OATPP_ASSERT(before->nested->name == "nested");
+
+    /* Plans of Obj and Nested are cached by now - they must pick up the new method */
+    bsonMapper.getSerializer()->setSerializerMethod(oatpp::data::mapping::type::__class::String::CLASS_ID, &serializeStringLength);
+
+    auto after = bsonMapper.readFromString<oatpp::Object<ObjInt>>(bsonMapper.writeToString(Obj::createShared()));
+    OATPP_ASSERT(*after->name == 3);
+    OATPP_ASSERT(*after->nested->name == 6);
+
+    OATPP_LOGI(TAG, "plan rebuild after setSerializerMethod - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "many types...");
+
+    typedef oatpp::data::mapping::type::Type Type;
+
+    /* The cache only compares type pointers - any distinct addresses will do */
+    static const v_int32 TYPES_COUNT = 4096;
+    std::vector<char> types(TYPES_COUNT);
+
+    oatpp::mongo::bson::mapping::PlanCache<v_int32> cache;
+    cache.clear(); // nothing cached - no-op
+
+    v_int32 built = 0;
+    auto builder = [&types, &built](const Type* type) {
+      built ++;
+      return std::unique_ptr<v_int32>(new v_int32((v_int32) ((const char*) type - types.data())));
+    };
+
+    for(v_int32 pass = 0; pass < 2; pass ++) {
+      for(v_int32 i = 0; i < TYPES_COUNT; i ++) {
+        OATPP_ASSERT(*cache.get((const Type*) &types[i], builder) == i);
+      }
+    }
+    OATPP_ASSERT(built == TYPES_COUNT);
+
+    cache.clear();
+    OATPP_ASSERT(*cache.get((const Type*) &types[7], builder) == 7);
+    OATPP_ASSERT(built == TYPES_COUNT + 1);
+
+    OATPP_LOGI(TAG, "many types - OK");
+  }
+
+}
+
+}}}}
@@ -0,0 +1,137 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ProjectionTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Nested : public oatpp::DTO {
+
+  DTO_INIT(Nested, DTO)
+
+  DTO_FIELD(String, a) = "nested-a";
+  DTO_FIELD(String, b) = "nested-b";
+
+};
+
+class Item : public oatpp::DTO {
+
+  DTO_INIT(Item, DTO)
+
+  DTO_FIELD(String, name) = "item";
+  DTO_FIELD(Int32, price) = 10;
+
+};
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(String, f1) = "value-1";
+  DTO_FIELD(String, f2) = "value-2";
+  DTO_FIELD(Object<Nested>, nested) = Nested::createShared();
+  DTO_FIELD(List<Object<Item>>, items) = {Item::createShared(), Item::createShared()};
+
+};
+
+class EmptyObj : public oatpp::DTO {
+
+  DTO_INIT(EmptyObj, DTO)
+
+  DTO_FIELD(String, f1);
+  DTO_FIELD(String, f2);
+  DTO_FIELD(Object<Nested>, nested);
+  DTO_FIELD(List<Object<Item>>, items);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void ProjectionTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+  oatpp::mongo::bson::mapping::Projection projection({"f1", "nested.a", "items.price"});
+
+  auto bson = bsonMapper.writeToString(Obj::createShared());
+
+  {
+    OATPP_LOGI(TAG, "DTO...");
+
+    auto obj = bsonMapper.readProjected<oatpp::Object<EmptyObj>>(bson, projection);
+
+    OATPP_ASSERT(obj->f1 == "value-1");
+    OATPP_ASSERT(obj->f2 == nullptr);
+    OATPP_ASSERT(obj->nested && obj->nested->a == "nested-a" && obj->nested->b == nullptr);
+    OATPP_ASSERT(obj->items && obj->items->size() == 2);
+    for(v_int32 i = 0; i < 2; i ++) {
+      auto& item = obj->items[i];
+      OATPP_ASSERT(*item->price == 10);
+      OATPP_ASSERT(item->name == "item"); // default value - not deserialized
+    }
+
+    OATPP_LOGI(TAG, "DTO - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Fields<Any>...");
+
+    auto fields = bsonMapper.readProjected<oatpp::Fields<oatpp::Any>>(bson, projection);
+
+    OATPP_ASSERT(fields->size() == 3);
+    OATPP_ASSERT(fields["f1"].retrieve<oatpp::String>() == "value-1");
+
+    auto nested = fields["nested"].retrieve<oatpp::Fields<oatpp::Any>>();
+    OATPP_ASSERT(nested->size() == 1);
+    OATPP_ASSERT(nested["a"].retrieve<oatpp::String>() == "nested-a");
+
+    OATPP_LOGI(TAG, "Fields<Any> - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "whole value...");
+
+    oatpp::mongo::bson::mapping::Projection wholeProjection({"nested", "nested.a"});
+    auto obj = bsonMapper.readProjected<oatpp::Object<EmptyObj>>(bson, wholeProjection);
+
+    OATPP_ASSERT(obj->f1 == nullptr);
+    OATPP_ASSERT(obj->nested && obj->nested->a == "nested-a" && obj->nested->b == "nested-b");
+
+    OATPP_LOGI(TAG, "whole value - OK");
+  }
+
+}
+
+}}}}
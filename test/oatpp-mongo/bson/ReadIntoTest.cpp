@@ -0,0 +1,138 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ReadIntoTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+#include "oatpp-mongo/bson/mapping/ObjectPool.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Nested : public oatpp::DTO {
+
+  DTO_INIT(Nested, DTO)
+
+  DTO_FIELD(String, f1);
+
+};
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(String, f1);
+  DTO_FIELD(String, f2);
+  DTO_FIELD(Object<Nested>, nested);
+  DTO_FIELD(List<String>, list);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void ReadIntoTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+  bsonMapper.getSerializer()->getConfig()->includeNullFields = false;
+
+  auto obj1 = Obj::createShared();
+  obj1->f1 = "value-1";
+  obj1->f2 = "value-2";
+  obj1->nested = Nested::createShared();
+  obj1->nested->f1 = "nested-1";
+  obj1->list = {"a", "b"};
+
+  auto obj2 = Obj::createShared();
+  obj2->f1 = "other-1";
+  obj2->nested = Nested::createShared();
+  obj2->nested->f1 = "other-nested-1";
+
+  auto bson1 = bsonMapper.writeToString(obj1);
+  auto bson2 = bsonMapper.writeToString(obj2);
+
+  {
+    OATPP_LOGI(TAG, "readInto...");
+
+    auto obj = Obj::createShared();
+
+    oatpp::parser::Caret caret1(bson1);
+    bsonMapper.readInto(obj, caret1);
+    OATPP_ASSERT(!caret1.hasError());
+    OATPP_ASSERT(obj->f1 == "value-1" && obj->f2 == "value-2");
+    OATPP_ASSERT(obj->list && obj->list->size() == 2);
+
+    auto nested = obj->nested.get();
+
+    oatpp::parser::Caret caret2(bson2);
+    bsonMapper.readInto(obj, caret2);
+    OATPP_ASSERT(!caret2.hasError());
+    OATPP_ASSERT(obj->f1 == "other-1");
+    OATPP_ASSERT(obj->f2 == nullptr);
+    OATPP_ASSERT(obj->list == nullptr);
+    OATPP_ASSERT(obj->nested.get() == nested); // nested object is reused
+    OATPP_ASSERT(obj->nested->f1 == "other-nested-1");
+
+    oatpp::parser::Caret caret3(bson1);
+    bsonMapper.readInto(obj, caret3);
+    OATPP_ASSERT(obj->f2 == "value-2");
+    OATPP_ASSERT(obj->nested.get() == nested);
+    OATPP_ASSERT(obj->nested->f1 == "nested-1");
+
+    OATPP_LOGI(TAG, "readInto - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "ObjectPool...");
+
+    oatpp::mongo::bson::mapping::ObjectPool<Obj> pool(1);
+
+    auto obj = pool.acquire();
+    auto ptr = obj.get();
+    pool.release(obj);
+    OATPP_ASSERT(obj == nullptr);
+    OATPP_ASSERT(pool.getSize() == 1);
+
+    obj = pool.acquire();
+    OATPP_ASSERT(obj.get() == ptr);
+    OATPP_ASSERT(pool.getSize() == 0);
+
+    auto ref = obj;
+    pool.release(obj);
+    OATPP_ASSERT(pool.getSize() == 0); // still referenced - not recycled
+
+    OATPP_LOGI(TAG, "ObjectPool - OK");
+  }
+
+}
+
+}}}}
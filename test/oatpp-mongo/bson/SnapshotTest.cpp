@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "SnapshotTest.hpp"
+
+#include "oatpp-mongo/bson/mapping/Snapshot.hpp"
+
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace bson {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Nested : public oatpp::DTO {
+
+  DTO_INIT(Nested, DTO)
+
+  DTO_FIELD(String, f1) = "nested-1";
+  DTO_FIELD(String, f2) = "nested-2";
+
+};
+
+class Obj : public oatpp::DTO {
+
+  DTO_INIT(Obj, DTO)
+
+  DTO_FIELD(String, f1) = "value-1";
+  DTO_FIELD(String, f2) = "value-2";
+  DTO_FIELD(String, f3) = "value-3";
+  DTO_FIELD(Object<Nested>, nested) = Nested::createShared();
+  DTO_FIELD(List<Int32>, list) = {1, 2, 3};
+
+};
+
+class ExpectedSet : public oatpp::DTO {
+
+  DTO_INIT(ExpectedSet, DTO)
+
+  DTO_FIELD(String, f2);
+  DTO_FIELD(String, nestedF1, "nested.f1");
+  DTO_FIELD(List<Int32>, list);
+
+};
+
+class ExpectedUnset : public oatpp::DTO {
+
+  DTO_INIT(ExpectedUnset, DTO)
+
+  DTO_FIELD(String, f3) = "";
+
+};
+
+class ExpectedUpdate : public oatpp::DTO {
+
+  DTO_INIT(ExpectedUpdate, DTO)
+
+  DTO_FIELD(Object<ExpectedSet>, set, "$set") = ExpectedSet::createShared();
+  DTO_FIELD(Object<ExpectedUnset>, unset, "$unset") = ExpectedUnset::createShared();
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void SnapshotTest::onRun() {
+
+  oatpp::mongo::bson::mapping::ObjectMapper bsonMapper;
+  bsonMapper.getSerializer()->getConfig()->includeNullFields = false;
+
+  auto obj = bsonMapper.readFromString<oatpp::Object<Obj>>(bsonMapper.writeToString(Obj::createShared()));
+  auto snapshot = oatpp::mongo::bson::mapping::Snapshot::capture(&bsonMapper, obj);
+
+  {
+    OATPP_LOGI(TAG, "no changes...");
+    OATPP_ASSERT(snapshot.diff(&bsonMapper, obj) == nullptr);
+    OATPP_LOGI(TAG, "no changes - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "changes...");
+
+    obj->f2 = "changed-2";
+    obj->f3 = nullptr;
+    obj->nested->f1 = "changed-nested-1";
+    obj->list->push_back(4);
+
+    auto update = snapshot.diff(&bsonMapper, obj);
+    OATPP_ASSERT(update);
+
+    auto expected = ExpectedUpdate::createShared();
+    expected->set->f2 = obj->f2;
+    expected->set->nestedF1 = obj->nested->f1;
+    expected->set->list = obj->list;
+
+    OATPP_ASSERT(oatpp::String(update.getPtr()) == bsonMapper.writeToString(expected));
+
+    OATPP_LOGI(TAG, "changes - OK");
+  }
+
+}
+
+}}}}
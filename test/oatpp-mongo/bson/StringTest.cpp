@@ -27,6 +27,7 @@
 
 #include "oatpp-mongo/TestUtils.hpp"
 #include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+#include "oatpp-mongo/bson/Types.hpp"
 
 #include "oatpp/core/Types.hpp"
 #include "oatpp/core/macro/codegen.hpp"
@@ -93,6 +94,18 @@ class Sub4 : public oatpp::DTO {
 
 };
 
+/* Strings referencing the source document */
+class SharedObj : public oatpp::DTO {
+
+  DTO_INIT(SharedObj, DTO)
+
+  DTO_FIELD(oatpp::mongo::bson::SharedString, f1);
+  DTO_FIELD(oatpp::mongo::bson::SharedString, f2);
+  DTO_FIELD(oatpp::mongo::bson::SharedString, f3);
+  DTO_FIELD(oatpp::mongo::bson::SharedString, f4);
+
+};
+
 #include OATPP_CODEGEN_END(DTO)
 
 }
@@ -169,6 +182,59 @@ void StringTest::onRun() {
     OATPP_LOGI(TAG, "sub4 - OK");
   }
 
+  {
+    OATPP_LOGI(TAG, "shared...");
+    auto sub = bsonMapper.readFromString<oatpp::Object<SharedObj>>(bson);
+
+    OATPP_ASSERT(sub->f1->equals(obj->f1->data(), obj->f1->size()));
+    OATPP_ASSERT(sub->f2->equals(obj->f2->data(), obj->f2->size()));
+    OATPP_ASSERT(!sub->f3.getPtr());
+    OATPP_ASSERT(sub->f4->equals(obj->f4->data(), obj->f4->size()));
+
+    OATPP_ASSERT(sub->f2->getHandle().get() == bson.getPtr().get());
+    OATPP_ASSERT(sub->f2->getData() > bson->data() && sub->f2->getData() < bson->data() + bson->size());
+
+    OATPP_ASSERT(bsonMapper.writeToString(sub) == bson);
+
+    OATPP_LOGI(TAG, "shared - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "slices...");
+
+    auto config = oatpp::mongo::bson::mapping::Serializer::Config::createShared();
+    config->referenceThreshold = 4;
+    oatpp::mongo::bson::mapping::Serializer serializer(config);
+
+    oatpp::mongo::bson::SliceList slices;
+    serializer.serializeToSlices(&slices, obj);
+    serializer.serializeToSlices(&slices, obj);
+
+    OATPP_ASSERT(slices.getReferencesCount() == 4);
+    OATPP_ASSERT(slices.getSize() == (v_buff_size) bson->size() * 2);
+    OATPP_ASSERT(slices.toString() == bson + bson);
+
+    OATPP_LOGI(TAG, "slices - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "caller buffer...");
+
+    char small[8];
+    auto size = bsonMapper.writeToBuffer(small, sizeof(small), obj);
+    OATPP_ASSERT(size == (v_buff_size) bson->size());
+
+    std::vector<char> exact(size);
+    OATPP_ASSERT(bsonMapper.writeToBuffer(exact.data(), size, obj) == size);
+    OATPP_ASSERT(oatpp::String(exact.data(), size) == bson);
+
+    char buffer[256];
+    size = bsonMapper.writeToBuffer(buffer, sizeof(buffer), obj);
+    OATPP_ASSERT(oatpp::String(buffer, size) == bson);
+
+    OATPP_LOGI(TAG, "caller buffer - OK");
+  }
+
 }
 
 }}}}
\ No newline at end of file
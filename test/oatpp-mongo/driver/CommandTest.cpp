@@ -0,0 +1,338 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *                         Benedikt-Alexander Mokroß <bam@icognize.de>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "CommandTest.hpp"
+
+#include "oatpp-mongo/driver/command/Insert.hpp"
+#include "oatpp-mongo/driver/command/Update.hpp"
+#include "oatpp-mongo/driver/wire/OpMsg.hpp"
+#include "oatpp-mongo/bson/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/Types.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace mongo { namespace test { namespace driver {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Doc : public oatpp::DTO {
+
+  DTO_INIT(Doc, DTO)
+
+  DTO_FIELD(Int32, index);
+  DTO_FIELD(String, payload);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+oatpp::Object<Doc> createDoc(v_int32 index, v_buff_size payloadSize) {
+  auto doc = Doc::createShared();
+  doc->index = index;
+  doc->payload = oatpp::String(std::string(payloadSize, 'x'));
+  return doc;
+}
+
+/*
+ * Write message the same way Connection does - header, then data slices.
+ */
+oatpp::String writeMessage(const oatpp::mongo::driver::wire::Message& message) {
+  oatpp::data::stream::BufferOutputStream stream;
+  message.header.writeToStream(&stream);
+  message.dataSlices->writeToStream(&stream);
+  return stream.toString();
+}
+
+/*
+ * Read documents of the "documents" sequence of the Insert message.
+ */
+std::list<oatpp::String> readDocuments(const oatpp::mongo::driver::wire::Message& message) {
+  auto data = writeMessage(message);
+  oatpp::parser::Caret caret(data->data() + 16, data->size() - 16);
+  oatpp::mongo::driver::wire::OpMsg msg;
+  OATPP_ASSERT(msg.readFromCaret(caret));
+  return std::static_pointer_cast<oatpp::mongo::driver::wire::DocumentSequenceSection>(msg.sections.back())->documents;
+}
+
+template<class Command>
+bool addDocumentThrows(Command& command, const oatpp::Void& document, oatpp::mongo::bson::mapping::ObjectMapper* objectMapper) {
+  try {
+    command.addDocument(document, objectMapper);
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+template<class Command>
+bool addDocumentThrows(Command& command, const oatpp::String& document) {
+  try {
+    command.addDocument(document);
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+template<class Command>
+bool toMessageThrows(Command& command, oatpp::mongo::bson::mapping::ObjectMapper* commandObjectMapper) {
+  try {
+    command.toMessage(commandObjectMapper);
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+}
+
+void CommandTest::onRun() {
+
+  typedef oatpp::mongo::driver::command::Insert Insert;
+  typedef oatpp::mongo::driver::command::Update Update;
+
+  oatpp::mongo::bson::mapping::ObjectMapper commandMapper;
+  commandMapper.getSerializer()->getConfig()->includeNullFields = false;
+
+  oatpp::mongo::bson::mapping::ObjectMapper objectMapper;
+
+  auto smallDoc = createDoc(0, 16);
+  auto largeDoc = createDoc(1, 1024);
+  v_buff_size smallSize = objectMapper.computeSize(smallDoc);
+  v_buff_size largeSize = objectMapper.computeSize(largeDoc);
+
+  {
+    OATPP_LOGI(TAG, "reject document exceeding maxBsonObjectSize...");
+
+    Insert emptyInsert("db", "collection");
+    v_int32 emptyLength = emptyInsert.toMessage(&commandMapper).header.messageLength;
+
+    Insert insert("db", "collection");
+    insert.setSizeLimits(largeSize - 1, Insert::DEFAULT_MAX_MESSAGE_SIZE);
+
+    OATPP_ASSERT(addDocumentThrows(insert, largeDoc, &objectMapper));
+    insert.addDocument(smallDoc, &objectMapper);
+    OATPP_ASSERT(insert.toMessage(&commandMapper).header.messageLength == emptyLength + smallSize); // rejected document is not serialized
+
+    Update update("db", "collection");
+    update.setSizeLimits(largeSize - 1, Update::DEFAULT_MAX_MESSAGE_SIZE);
+    OATPP_ASSERT(addDocumentThrows(update, largeDoc, &objectMapper));
+    update.addDocument(smallDoc, &objectMapper);
+
+    OATPP_LOGI(TAG, "reject document exceeding maxBsonObjectSize - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "count message header and body against maxMessageSizeBytes...");
+
+    /* The document alone fits - the message with its header and body section doesn't */
+    Insert insert("db", "collection");
+    insert.setSizeLimits(largeSize, largeSize + 16);
+    OATPP_ASSERT(addDocumentThrows(insert, largeDoc, &objectMapper));
+
+    Update update("db", "collection");
+    update.setSizeLimits(largeSize, largeSize + 16);
+    OATPP_ASSERT(addDocumentThrows(update, largeDoc, &objectMapper));
+
+    OATPP_LOGI(TAG, "count message header and body against maxMessageSizeBytes - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "serialized document at the limits...");
+
+    auto document = objectMapper.writeToString(smallDoc);
+    v_buff_size size = document->size();
+
+    Insert emptyInsert("db", "collection");
+    v_int32 emptyInsertLength = emptyInsert.toMessage(&commandMapper).header.messageLength;
+    Update emptyUpdate("db", "collection");
+    v_int32 emptyUpdateLength = emptyUpdate.toMessage(&commandMapper).header.messageLength;
+
+    Insert insert("db", "collection");
+    insert.setSizeLimits(size, emptyInsertLength + size);
+    insert.addDocument(document);
+    OATPP_ASSERT(insert.toMessage(&commandMapper).header.messageLength == emptyInsertLength + size);
+
+    Update update("db", "collection");
+    update.setSizeLimits(size, emptyUpdateLength + size);
+    update.addDocument(document);
+    OATPP_ASSERT(update.toMessage(&commandMapper).header.messageLength == emptyUpdateLength + size);
+
+    Insert bsonLimitInsert("db", "collection");
+    bsonLimitInsert.setSizeLimits(size - 1, Insert::DEFAULT_MAX_MESSAGE_SIZE);
+    OATPP_ASSERT(addDocumentThrows(bsonLimitInsert, document));
+    OATPP_ASSERT(bsonLimitInsert.toMessage(&commandMapper).header.messageLength == emptyInsertLength);
+
+    Update bsonLimitUpdate("db", "collection");
+    bsonLimitUpdate.setSizeLimits(size - 1, Update::DEFAULT_MAX_MESSAGE_SIZE);
+    OATPP_ASSERT(addDocumentThrows(bsonLimitUpdate, document));
+    OATPP_ASSERT(bsonLimitUpdate.toMessage(&commandMapper).header.messageLength == emptyUpdateLength);
+
+    /* The body is not measured yet - the whole message is checked once the body is encoded */
+    Insert messageLimitInsert("db", "collection");
+    messageLimitInsert.setSizeLimits(size, emptyInsertLength + size - 1);
+    messageLimitInsert.addDocument(document);
+    OATPP_ASSERT(toMessageThrows(messageLimitInsert, &commandMapper));
+
+    Update messageLimitUpdate("db", "collection");
+    messageLimitUpdate.setSizeLimits(size, emptyUpdateLength + size - 1);
+    messageLimitUpdate.addDocument(document);
+    OATPP_ASSERT(toMessageThrows(messageLimitUpdate, &commandMapper));
+
+    /* Body measured by the object mapper - counted against the limit when the document is added */
+    Insert measuredInsert("db", "collection");
+    measuredInsert.setSizeLimits(size, emptyInsertLength + size + smallSize - 1);
+    measuredInsert.addDocument(smallDoc, &commandMapper);
+    OATPP_ASSERT(addDocumentThrows(measuredInsert, document));
+
+    OATPP_LOGI(TAG, "serialized document at the limits - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "message length matches written message...");
+
+    auto config = oatpp::mongo::bson::mapping::Serializer::Config::createShared();
+    config->referenceThreshold = 64; // payload of largeDoc is referenced in place
+    oatpp::mongo::bson::mapping::ObjectMapper referencingMapper(config, oatpp::mongo::bson::mapping::Deserializer::Config::createShared());
+
+    Insert insert("db", "collection");
+    insert.addDocument(smallDoc, &referencingMapper);
+    insert.addDocument(largeDoc, &referencingMapper);
+    insert.addDocument(objectMapper.writeToString(smallDoc));
+
+    auto message = insert.toMessage(&commandMapper);
+    auto data = writeMessage(message);
+    OATPP_ASSERT(message.header.messageLength == (v_int32) data->size());
+
+    OATPP_ASSERT(message.hasDataSlices());
+    OATPP_ASSERT(message.data == nullptr);
+    OATPP_ASSERT(message.getDataSize() == (v_buff_size) data->size() - 16);
+    OATPP_ASSERT(message.getData() == oatpp::String(data->substr(16)));
+
+    oatpp::mongo::driver::wire::Message stringMessage(message.header.messageLength, message.header.opCode, message.getData());
+    OATPP_ASSERT(!stringMessage.hasDataSlices());
+    OATPP_ASSERT(stringMessage.getData() == message.getData());
+
+    /* Message holding neither form is invalid */
+    oatpp::mongo::driver::wire::Message emptyMessage;
+    bool thrown = false;
+    try {
+      emptyMessage.getDataSize();
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    oatpp::parser::Caret caret(data->data() + 16, data->size() - 16);
+    oatpp::mongo::driver::wire::OpMsg msg;
+    OATPP_ASSERT(msg.readFromCaret(caret));
+    OATPP_ASSERT(msg.sections.size() == 2);
+    auto documents = std::static_pointer_cast<oatpp::mongo::driver::wire::DocumentSequenceSection>(msg.sections.back());
+    OATPP_ASSERT(documents->identifier == "documents");
+    OATPP_ASSERT(documents->documents.size() == 3);
+    OATPP_ASSERT(documents->documents.front() == objectMapper.writeToString(smallDoc));
+
+    /* The message references documents of the command in place - they can't be changed anymore */
+    OATPP_ASSERT(addDocumentThrows(insert, smallDoc, &referencingMapper));
+
+    auto again = insert.toMessage(&commandMapper);
+    OATPP_ASSERT(again.header.messageLength == message.header.messageLength);
+    OATPP_ASSERT(writeMessage(again) == data);
+    OATPP_ASSERT(writeMessage(message) == data);
+
+    OATPP_LOGI(TAG, "message length matches written message - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "parallel batch...");
+
+    const v_int32 count = 1000;
+    auto docs = oatpp::Vector<oatpp::Object<Doc>>::createShared();
+    for(v_int32 i = 0; i < count; i ++) {
+      docs->push_back(createDoc(i, i % 100));
+    }
+
+    Insert insert("db", "collection");
+    insert.addDocument(createDoc(-1, 0), &objectMapper);
+    insert.addDocuments(docs, &objectMapper, 4);
+
+    auto message = insert.toMessage(&commandMapper);
+    OATPP_ASSERT(message.header.messageLength == (v_int32) writeMessage(message)->size());
+
+    auto documents = readDocuments(message);
+    OATPP_ASSERT(documents.size() == (size_t) count + 1);
+    v_int32 index = -1;
+    for(auto& document : documents) {
+      auto doc = objectMapper.readFromString<oatpp::Object<Doc>>(document);
+      OATPP_ASSERT(*doc->index == index);
+      OATPP_ASSERT((v_int32) doc->payload->size() == (index < 0 ? 0 : index % 100));
+      index ++;
+    }
+
+    OATPP_LOGI(TAG, "parallel batch - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "parallel batch exceeding limits...");
+
+    std::vector<oatpp::Void> docs;
+    for(v_int32 i = 0; i < 500; i ++) {
+      docs.push_back(i == 321 ? largeDoc : smallDoc);
+    }
+
+    Insert emptyInsert("db", "collection");
+    v_int32 emptyLength = emptyInsert.toMessage(&commandMapper).header.messageLength;
+
+    Insert insert("db", "collection");
+    insert.setSizeLimits(largeSize - 1, Insert::DEFAULT_MAX_MESSAGE_SIZE);
+    bool thrown = false;
+    try {
+      insert.addDocuments(docs, &objectMapper, 4);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    /* No document of the failed batch is added */
+    insert.setSizeLimits(Insert::DEFAULT_MAX_BSON_OBJECT_SIZE, emptyLength + smallSize * 499);
+    thrown = false;
+    try {
+      insert.addDocuments(docs, &objectMapper, 4);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_ASSERT(insert.toMessage(&commandMapper).header.messageLength == emptyLength);
+
+    OATPP_LOGI(TAG, "parallel batch exceeding limits - OK");
+  }
+
+}
+
+}}}}
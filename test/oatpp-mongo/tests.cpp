@@ -35,6 +35,21 @@
 #include "oatpp-mongo/bson/MapTest.hpp"
 #include "oatpp-mongo/bson/ObjectTest.hpp"
 #include "oatpp-mongo/bson/InlineDocumentTest.hpp"
+#include "oatpp-mongo/bson/CodecTest.hpp"
+#include "oatpp-mongo/bson/BinaryTest.hpp"
+#include "oatpp-mongo/bson/Decimal128Test.hpp"
+#include "oatpp-mongo/bson/SnapshotTest.hpp"
+#include "oatpp-mongo/bson/LazyDocumentTest.hpp"
+#include "oatpp-mongo/bson/ProjectionTest.hpp"
+#include "oatpp-mongo/bson/ReadIntoTest.hpp"
+#include "oatpp-mongo/bson/ArenaTest.hpp"
+#include "oatpp-mongo/bson/DocumentStreamParserTest.hpp"
+#include "oatpp-mongo/bson/PlanCacheTest.hpp"
+#include "oatpp-mongo/bson/FieldLookupTest.hpp"
+#include "oatpp-mongo/bson/InterpretationTest.hpp"
+#include "oatpp-mongo/bson/BufferArenaTest.hpp"
+
+#include "oatpp-mongo/driver/CommandTest.hpp"
 
 #include "oatpp-test/UnitTest.hpp"
 
@@ -249,6 +264,24 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::mongo::test::bson::InlineDocumentTest);
 
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::CodecTest);
+
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::BinaryTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::Decimal128Test);
+
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::SnapshotTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::LazyDocumentTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::ProjectionTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::ReadIntoTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::ArenaTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::DocumentStreamParserTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::PlanCacheTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::FieldLookupTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::InterpretationTest);
+  OATPP_RUN_TEST(oatpp::mongo::test::bson::BufferArenaTest);
+
+  OATPP_RUN_TEST(oatpp::mongo::test::driver::CommandTest);
+
 }
 
 }